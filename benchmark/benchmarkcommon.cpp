@@ -0,0 +1,74 @@
+#include "benchmark/benchmarkcommon.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+
+namespace wl::benchmark {
+
+bool parseOptions(int argc, char* argv[], const OptionHandlers& handlers)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const auto handler = handlers.find(argv[i]);
+        if (handler == handlers.end() || i + 1 >= argc)
+        {
+            return false;
+        }
+        handler->second(argv[++i]);
+    }
+    return true;
+}
+
+std::string escapeJson(const std::string& text)
+{
+    std::string escaped;
+    for (const char character : text)
+    {
+        if (character == '"' || character == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += character;
+    }
+    return escaped;
+}
+
+Distribution getDistribution(std::vector<double> samples)
+{
+    Distribution distribution;
+    if (samples.empty())
+    {
+        return distribution;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    distribution.count = samples.size();
+    distribution.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    distribution.median = samples[samples.size() / 2];
+    distribution.minimum = samples.front();
+    distribution.p95 = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+    distribution.maximum = samples.back();
+    return distribution;
+}
+
+bool writeOutput(const std::string& outputPath, const std::function<void(std::ostream& stream)>& write)
+{
+    if (outputPath.empty())
+    {
+        write(std::cout);
+        return true;
+    }
+
+    std::ofstream file(outputPath);
+    write(file);
+    if (!file)
+    {
+        std::cerr << "Failed to write " << outputPath << "\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace wl::benchmark
@@ -0,0 +1,81 @@
+#ifndef WL_BENCHMARKCOMMON_H
+#define WL_BENCHMARKCOMMON_H
+
+#include "wl/error.h"
+
+#include <etl/expected.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace wl::benchmark {
+
+/**
+ * @brief Handlers of command line options taking a value, keyed by the option (e.g. "--output").
+ */
+using OptionHandlers = std::map<std::string, std::function<void(const std::string& value)>>;
+
+/**
+ * @struct Distribution
+ * @headerfile benchmarkcommon.h "benchmark/benchmarkcommon.h"
+ * @brief Summary of measured samples.
+ */
+struct Distribution
+{
+    size_t count {0};     ///< Number of samples.
+    double mean {0.0};    ///< Mean of the samples.
+    double median {0.0};  ///< Median of the samples.
+    double minimum {0.0}; ///< Smallest sample.
+    double p95 {0.0};     ///< 95th percentile of the samples.
+    double maximum {0.0}; ///< Largest sample.
+};
+
+/**
+ * @brief Retrieves the error of a result as text.
+ * @param result The result.
+ * @return Empty string on success, name of the error otherwise.
+ */
+template <typename T>
+std::string getError(const etl::expected<T, Error>& result)
+{
+    return result.has_value() ? std::string() : std::string(result.error().c_str());
+}
+
+/**
+ * @brief Parses command line options given as "--option value" pairs.
+ * @param argc Number of arguments.
+ * @param argv Arguments, the first one is the program.
+ * @param handlers Handlers of the known options.
+ * @return False if an option is unknown or its value is missing.
+ */
+bool parseOptions(int argc, char* argv[], const OptionHandlers& handlers);
+
+/**
+ * @brief Escapes text for a JSON string.
+ * @param text The text.
+ * @return Text with quotes and backslashes escaped.
+ */
+std::string escapeJson(const std::string& text);
+
+/**
+ * @brief Summarizes samples.
+ * @param samples The samples, in any order.
+ * @return The summary, all zero without samples.
+ */
+Distribution getDistribution(std::vector<double> samples);
+
+/**
+ * @brief Writes results to the standard output or to a file.
+ * @param outputPath Path of the file, empty for the standard output.
+ * @param write Writes the results to the stream.
+ * @return False if the file could not be written, the failure is reported to the standard error.
+ */
+bool writeOutput(const std::string& outputPath, const std::function<void(std::ostream& stream)>& write);
+
+} // namespace wl::benchmark
+
+#endif // WL_BENCHMARKCOMMON_H
@@ -0,0 +1,259 @@
+#include "benchmark/benchmarkcommon.h"
+#include "simulator/simulatordatalinkinterface.h"
+#include "simulator/simulatorweom.h"
+
+#include "wl/weom.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using wl::benchmark::getError;
+
+struct Cost
+{
+    uint64_t transactions = 0;
+    uint64_t transmittedBytes = 0; // request bytes sent to the device
+    uint64_t receivedBytes = 0;    // response bytes received from the device
+};
+
+struct Call
+{
+    std::string name;
+    std::function<std::string(wl::WEOM&)> operation;
+};
+
+#define WL_BUDGET_CALL(name, expression) Call {name, [](wl::WEOM& weom) { return getError(expression); }}
+
+std::vector<Call> getCalls()
+{
+    constexpr auto REGISTERS = wl::MemoryTypeWEOM::REGISTERS_CONFIGURATION;
+    constexpr auto FLASH = wl::MemoryTypeWEOM::FLASH_MEMORY;
+
+    return {
+        WL_BUDGET_CALL("getStatus", weom.getStatus()),
+        WL_BUDGET_CALL("getTriggers", weom.getTriggers()),
+        WL_BUDGET_CALL("activateTrigger", weom.activateTrigger(wl::Trigger::NUC_OFFSET_UPDATE)),
+        WL_BUDGET_CALL("getFirmwareVersion", weom.getFirmwareVersion()),
+        WL_BUDGET_CALL("getSerialNumber", weom.getSerialNumber()),
+        WL_BUDGET_CALL("getArticleNumber", weom.getArticleNumber()),
+        WL_BUDGET_CALL("getShutterTemperature", weom.getShutterTemperature()),
+        WL_BUDGET_CALL("getLedRedBrightness", weom.getLedRedBrightness()),
+        WL_BUDGET_CALL("setLedRedBrightness", weom.setLedRedBrightness(10, REGISTERS)),
+        WL_BUDGET_CALL("getTriggerMode", weom.getTriggerMode()),
+        WL_BUDGET_CALL("getAuxPin", weom.getAuxPin(0)),
+        WL_BUDGET_CALL("getPaletteIndex", weom.getPaletteIndex()),
+        WL_BUDGET_CALL("setPaletteIndex", weom.setPaletteIndex(1, REGISTERS)),
+        WL_BUDGET_CALL("setPaletteIndex/flash", weom.setPaletteIndex(1, FLASH)),
+        WL_BUDGET_CALL("getPaletteName", weom.getPaletteName(0)),
+        WL_BUDGET_CALL("getFramerate", weom.getFramerate()),
+        WL_BUDGET_CALL("getImageFlip", weom.getImageFlip()),
+        WL_BUDGET_CALL("getImageFreeze", weom.getImageFreeze()),
+        WL_BUDGET_CALL("setImageFreeze", weom.setImageFreeze(false)),
+        WL_BUDGET_CALL("getVideoFormat", weom.getVideoFormat()),
+        WL_BUDGET_CALL("getImageGenerator", weom.getImageGenerator()),
+        WL_BUDGET_CALL("getReticleType", weom.getReticleType()),
+        WL_BUDGET_CALL("getReticlePositionX", weom.getReticlePositionX()),
+        WL_BUDGET_CALL("getReticlePositionY", weom.getReticlePositionY()),
+        WL_BUDGET_CALL("getShutterCounter", weom.getShutterCounter()),
+        WL_BUDGET_CALL("getTimeFromLastNucOffsetUpdate", weom.getTimeFromLastNucOffsetUpdate()),
+        WL_BUDGET_CALL("getShutterUpdateMode", weom.getShutterUpdateMode()),
+        WL_BUDGET_CALL("getInternalShutterPosition", weom.getInternalShutterPosition()),
+        WL_BUDGET_CALL("getShutterMaxPeriod", weom.getShutterMaxPeriod()),
+        WL_BUDGET_CALL("getShutterAdaptiveThreshold", weom.getShutterAdaptiveThreshold()),
+        WL_BUDGET_CALL("getUartBaudrate", weom.getUartBaudrate()),
+        WL_BUDGET_CALL("getTimeDomainAveraging", weom.getTimeDomainAveraging()),
+        WL_BUDGET_CALL("getImageEqualizationType", weom.getImageEqualizationType()),
+        WL_BUDGET_CALL("getMgcContrastBrightness", weom.getMgcContrastBrightness()),
+        WL_BUDGET_CALL("getFrameBlockMedianConbright", weom.getFrameBlockMedianConbright()),
+        WL_BUDGET_CALL("getAgcNhSmoothingFrames", weom.getAgcNhSmoothingFrames()),
+        WL_BUDGET_CALL("getSpatialMedianFilterEnabled", weom.getSpatialMedianFilterEnabled()),
+        WL_BUDGET_CALL("getLinearGainWeight", weom.getLinearGainWeight()),
+        WL_BUDGET_CALL("getClipLimit", weom.getClipLimit()),
+        WL_BUDGET_CALL("setClipLimit", weom.setClipLimit(20, REGISTERS)),
+        WL_BUDGET_CALL("setClipLimit/flash", weom.setClipLimit(20, FLASH)),
+        WL_BUDGET_CALL("getPlateauTailRejection", weom.getPlateauTailRejection()),
+        WL_BUDGET_CALL("getSmartTimeDomainAverageThreshold", weom.getSmartTimeDomainAverageThreshold()),
+        WL_BUDGET_CALL("getSmartMedianThreshold", weom.getSmartMedianThreshold()),
+        WL_BUDGET_CALL("getGammaCorrection", weom.getGammaCorrection()),
+        WL_BUDGET_CALL("setGammaCorrection", weom.setGammaCorrection(1.5, REGISTERS)),
+        WL_BUDGET_CALL("getMaxAmplification", weom.getMaxAmplification()),
+        WL_BUDGET_CALL("getDampingFactor", weom.getDampingFactor()),
+        WL_BUDGET_CALL("getPresetIdCount", weom.getPresetIdCount()),
+        WL_BUDGET_CALL("getPresetId", weom.getPresetId()),
+        WL_BUDGET_CALL("getPresetId/index", weom.getPresetId(uint8_t(1))),
+        WL_BUDGET_CALL("getPresetIndex", weom.getPresetIndex()),
+        WL_BUDGET_CALL("setPresetId/index", weom.setPresetId(uint8_t(1))),
+        WL_BUDGET_CALL("saveCurrentPresetIndexToFlash", weom.saveCurrentPresetIndexToFlash()),
+        WL_BUDGET_CALL("readSnapshot", weom.readSnapshot()),
+        Call {"readSnapshot+apply/unchanged", [](wl::WEOM& weom)
+        {
+            const auto snapshot = weom.readSnapshot();
+            return snapshot.has_value() ? getError(weom.apply(snapshot.value(), wl::MemoryTypeWEOM::REGISTERS_CONFIGURATION)) : getError(snapshot);
+        }},
+    };
+}
+
+#undef WL_BUDGET_CALL
+
+Cost getCost(const wl::SimulatorWEOM& simulator)
+{
+    return Cost {simulator.getRequestsCount(), simulator.getReceivedBytesCount(), simulator.getTransmittedBytesCount()};
+}
+
+void sleepFor(const wl::Clock::duration& duration)
+{
+    std::this_thread::sleep_for(duration);
+}
+
+std::string connect(wl::SimulatorWEOM& simulator, wl::WEOM& weom)
+{
+    // without line timing, only the number of transfers matters
+    return getError(weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(new wl::SimulatorDataLinkInterface(simulator, 0))));
+}
+
+// each call gets a fresh device and WEOM, so its cost does not depend on the register cache and device state left by other calls
+std::string measureCall(const Call& call, Cost& cost)
+{
+    wl::SimulatorWEOM simulator;
+    wl::WEOM weom(sleepFor);
+    if (const auto error = connect(simulator, weom); !error.empty())
+    {
+        return "setDataLinkInterface: " + error;
+    }
+
+    const auto before = getCost(simulator);
+    const auto error = call.operation(weom);
+    const auto after = getCost(simulator);
+    cost = Cost {after.transactions - before.transactions, after.transmittedBytes - before.transmittedBytes, after.receivedBytes - before.receivedBytes};
+    return error;
+}
+
+bool readBudget(const std::string& path, std::map<std::string, Cost>& budget)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (line.empty() || line.front() == '#')
+        {
+            continue;
+        }
+
+        std::istringstream stream(line);
+        std::string name;
+        Cost cost;
+        if (!(stream >> name >> cost.transactions >> cost.transmittedBytes >> cost.receivedBytes))
+        {
+            std::cerr << "Invalid budget line: " << line << "\n";
+            return false;
+        }
+        budget[name] = cost;
+    }
+    return true;
+}
+
+void writeBudget(std::ostream& stream, const std::vector<std::pair<std::string, Cost>>& costs)
+{
+    stream << "# Maximum TCSI transactions and wire bytes of WEOM calls, checked by weomlink_budget.\n"
+           << "# Lower the numbers when a call gets cheaper, raise them only with a good reason.\n"
+           << "# call transactions tx_bytes rx_bytes\n";
+    for (const auto& [name, cost] : costs)
+    {
+        stream << name << " " << cost.transactions << " " << cost.transmittedBytes << " " << cost.receivedBytes << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 3 || (argc == 3 && std::string(argv[2]) != "--update"))
+    {
+        std::cerr << "Usage: " << argv[0] << " <budget file> [--update]\n"
+                  << "Counts TCSI transactions and wire bytes of WEOM calls against the simulated device\n"
+                  << "and compares them with the budget file (--update rewrites it with the measured costs).\n";
+        return EXIT_FAILURE;
+    }
+    const std::string budgetPath = argv[1];
+    const bool update = argc == 3;
+
+    std::vector<std::pair<std::string, Cost>> costs;
+
+    wl::SimulatorWEOM simulator;
+    wl::WEOM weom(sleepFor);
+    if (const auto error = connect(simulator, weom); !error.empty())
+    {
+        std::cerr << "Failed to connect to the simulator: " << error << "\n";
+        return EXIT_FAILURE;
+    }
+    costs.emplace_back("setDataLinkInterface", getCost(simulator));
+
+    for (const auto& call : getCalls())
+    {
+        Cost cost;
+        if (const auto error = measureCall(call, cost); !error.empty())
+        {
+            std::cerr << call.name << " failed: " << error << "\n";
+            return EXIT_FAILURE;
+        }
+        costs.emplace_back(call.name, cost);
+    }
+
+    if (update)
+    {
+        std::ofstream file(budgetPath);
+        writeBudget(file, costs);
+        return file ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    std::map<std::string, Cost> budget;
+    if (!readBudget(budgetPath, budget))
+    {
+        std::cerr << "Failed to read " << budgetPath << "\n";
+        return EXIT_FAILURE;
+    }
+
+    bool exceeded = false;
+    for (const auto& [name, cost] : costs)
+    {
+        const auto limit = budget.find(name);
+        std::string verdict = "ok";
+        if (limit == budget.end())
+        {
+            verdict = "NO BUDGET";
+            exceeded = true;
+        }
+        else if (cost.transactions > limit->second.transactions || cost.transmittedBytes > limit->second.transmittedBytes ||
+                 cost.receivedBytes > limit->second.receivedBytes)
+        {
+            verdict = "EXCEEDED (budget " + std::to_string(limit->second.transactions) + " " + std::to_string(limit->second.transmittedBytes) +
+                      " " + std::to_string(limit->second.receivedBytes) + ")";
+            exceeded = true;
+        }
+        else if (cost.transactions < limit->second.transactions || cost.transmittedBytes < limit->second.transmittedBytes ||
+                 cost.receivedBytes < limit->second.receivedBytes)
+        {
+            verdict = "below budget, lower it with --update";
+        }
+
+        std::cout << std::left << std::setw(36) << name << std::right << std::setw(4) << cost.transactions << std::setw(6) << cost.transmittedBytes
+                  << std::setw(6) << cost.receivedBytes << "  " << verdict << "\n";
+    }
+
+    return exceeded ? EXIT_FAILURE : EXIT_SUCCESS;
+}
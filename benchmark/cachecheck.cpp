@@ -0,0 +1,82 @@
+#include "benchmark/benchmarkcommon.h"
+#include "simulator/simulatordatalinkinterface.h"
+#include "simulator/simulatorweom.h"
+
+#include "wl/weom.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+using wl::benchmark::getError;
+
+void sleepFor(const wl::Clock::duration& duration)
+{
+    std::this_thread::sleep_for(duration);
+}
+
+uint32_t readDeviceWord(const wl::SimulatorWEOM& simulator, uint32_t address)
+{
+    etl::array<uint8_t, sizeof(uint32_t)> data = {};
+    simulator.peek(address, data);
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// values read through a select register and a data register have to come from the device every time
+bool checkPresetIds(wl::WEOM& weom, const wl::SimulatorWEOM& simulator)
+{
+    const auto count = weom.getPresetIdCount();
+    if (!count.has_value())
+    {
+        std::cerr << "getPresetIdCount failed: " << getError(count) << "\n";
+        return false;
+    }
+
+    bool passed = true;
+    // the second round reads the indexes again with everything cached by the first one
+    for (int round = 0; round < 2; ++round)
+    {
+        for (uint8_t index = 0; index < count.value(); ++index)
+        {
+            const auto presetId = weom.getPresetId(index);
+            const uint32_t expected = readDeviceWord(simulator, wl::SimulatorWEOM::PRESET_ATTRIBUTES_ADDRESS + index * sizeof(uint32_t));
+            std::string verdict = "ok";
+            if (!presetId.has_value())
+            {
+                verdict = "FAILED: " + getError(presetId);
+                passed = false;
+            }
+            else if (presetId.value().toDeviceValue() != expected)
+            {
+                verdict = "MISMATCH (device " + std::to_string(expected) + ", read " + std::to_string(presetId.value().toDeviceValue()) + ")";
+                passed = false;
+            }
+            std::cout << "getPresetId(" << int(index) << ") round " << round << "  " << verdict << "\n";
+        }
+    }
+    return passed;
+}
+
+} // namespace
+
+int main()
+{
+    wl::SimulatorWEOM simulator;
+    wl::WEOM weom(sleepFor);
+    for (const auto registerClass : {wl::RegisterClassWEOM::IDENTIFICATION, wl::RegisterClassWEOM::CONFIGURATION, wl::RegisterClassWEOM::TELEMETRY})
+    {
+        weom.setRegisterCachePolicy(registerClass, wl::RegisterCachePolicyWEOM::ENABLED);
+    }
+
+    // without line timing, only the number of transfers matters
+    if (const auto result = weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(new wl::SimulatorDataLinkInterface(simulator, 0))); !result.has_value())
+    {
+        std::cerr << "Failed to connect to the simulator: " << result.error().c_str() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return checkPresetIds(weom, simulator) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
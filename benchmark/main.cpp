@@ -0,0 +1,302 @@
+#include "benchmark/benchmarkcommon.h"
+#include "simulator/simulatordatalinkinterface.h"
+#include "simulator/simulatorweom.h"
+
+#include "wl/communication/tcsipacket.h"
+#include "wl/communication/tcsirequest.h"
+#include "wl/communication/tcsiresponseparser.h"
+#include "wl/dataclasses/baudrate.h"
+#include "wl/weom.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace wl::benchmark;
+
+using BenchmarkClock = std::chrono::steady_clock;
+
+struct Options
+{
+    size_t iterations = 20;
+    std::chrono::microseconds turnaroundLatency {100};
+    std::string filter;
+    std::string outputPath;
+};
+
+struct Result
+{
+    std::string name;
+    std::string group;
+    uint32_t baudrate = 0;
+    std::vector<double> samples; // nanoseconds per operation
+    std::string error;
+};
+
+// keeps the optimizer from removing benchmarked code
+volatile size_t g_sink = 0;
+
+void printUsage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--iterations <count>] [--turnaround-us <microseconds>] [--filter <substring>] [--output <file>]\n"
+              << "Measures the TCSI packet codec and WEOM API latency against the simulated device, results are printed as JSON.\n";
+}
+
+// times batches of fast operations, clock overhead would dominate single calls
+template <typename Operation>
+Result measureCodec(const std::string& name, Operation operation)
+{
+    static constexpr size_t SAMPLES = 50;
+    static constexpr size_t BATCH = 2000;
+
+    Result result {name, "codec", 0, {}, {}};
+    for (size_t sample = 0; sample < SAMPLES; ++sample)
+    {
+        const auto start = BenchmarkClock::now();
+        for (size_t i = 0; i < BATCH; ++i)
+        {
+            g_sink = g_sink + operation(i);
+        }
+        const std::chrono::duration<double, std::nano> elapsed = BenchmarkClock::now() - start;
+        result.samples.push_back(elapsed.count() / BATCH);
+    }
+    return result;
+}
+
+// times single API calls, the operation returns an error message on failure
+template <typename Operation>
+Result measureApi(const std::string& name, uint32_t baudrate, size_t iterations, Operation operation)
+{
+    Result result {name, "api", baudrate, {}, {}};
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        const auto start = BenchmarkClock::now();
+        const std::string error = operation(i);
+        const std::chrono::duration<double, std::nano> elapsed = BenchmarkClock::now() - start;
+        if (!error.empty())
+        {
+            result.error = error;
+            break;
+        }
+        result.samples.push_back(elapsed.count());
+    }
+    return result;
+}
+
+
+void runCodecBenchmarks(const Options& options, std::vector<Result>& results)
+{
+    const auto enabled = [&options](const std::string& name)
+    {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    };
+
+    std::vector<uint8_t> payload(wl::MemorySpaceWEOM::REGISTERS_MAXIMUM_DATA_SIZE);
+    std::iota(payload.begin(), payload.end(), 0);
+    const auto smallPayload = etl::span<const uint8_t>(payload.data(), wl::MemorySpaceWEOM::REGISTERS_MINIMUM_DATA_SIZE);
+    const auto largePayload = etl::span<const uint8_t>(payload.data(), payload.size());
+
+    if (enabled("createReadRequest"))
+    {
+        results.push_back(measureCodec("createReadRequest", [](size_t i)
+        {
+            return wl::TCSIPacket::createReadRequest(i, 0x0600, 4).getPacketData().size();
+        }));
+    }
+    if (enabled("createWriteRequest/4"))
+    {
+        results.push_back(measureCodec("createWriteRequest/4", [&smallPayload](size_t i)
+        {
+            return wl::TCSIPacket::createWriteRequest(i, 0x0600, smallPayload).getPacketData().size();
+        }));
+    }
+    if (enabled("createWriteRequest/252"))
+    {
+        results.push_back(measureCodec("createWriteRequest/252", [&largePayload](size_t i)
+        {
+            return wl::TCSIPacket::createWriteRequest(i, 0x0600, largePayload).getPacketData().size();
+        }));
+    }
+    if (enabled("TCSIRequest::createWriteRequest/252"))
+    {
+        results.push_back(measureCodec("TCSIRequest::createWriteRequest/252", [&largePayload](size_t i)
+        {
+            return wl::TCSIRequest::createWriteRequest(i, 0x0600, largePayload).getSize();
+        }));
+    }
+
+    const auto request = wl::TCSIPacket::createWriteRequest(1, 0x0600, largePayload);
+    const auto response = wl::TCSIPacket::createOkResponse(1, 0x0600, largePayload);
+    if (enabled("validate"))
+    {
+        results.push_back(measureCodec("validate", [&response](size_t)
+        {
+            return static_cast<size_t>(response.validate().has_value());
+        }));
+    }
+    if (enabled("validateAsRequest"))
+    {
+        results.push_back(measureCodec("validateAsRequest", [&request](size_t)
+        {
+            return static_cast<size_t>(request.validateAsRequest().has_value());
+        }));
+    }
+    if (enabled("validateAsOkResponse"))
+    {
+        results.push_back(measureCodec("validateAsOkResponse", [&response, &largePayload](size_t)
+        {
+            return static_cast<size_t>(response.validateAsOkResponse(0x0600, largePayload.size()).has_value());
+        }));
+    }
+    if (enabled("getExpectedDataSize"))
+    {
+        results.push_back(measureCodec("getExpectedDataSize", [&response](size_t)
+        {
+            return static_cast<size_t>(response.getExpectedDataSize().value_or(0));
+        }));
+    }
+    if (enabled("TCSIResponseParser::parse/252"))
+    {
+        results.push_back(measureCodec("TCSIResponseParser::parse/252", [&response, parser = wl::TCSIResponseParser()](size_t) mutable
+        {
+            const auto& frame = response.getPacketData();
+            const auto receiveBuffer = parser.prepare(frame.size());
+            std::copy(frame.begin(), frame.end(), receiveBuffer.begin());
+            parser.commit(frame.size());
+            if (!parser.parse().value_or(false))
+            {
+                return size_t(0);
+            }
+            const size_t payloadSize = parser.getFrame().getPayloadData().size();
+            parser.consumeFrame();
+            return payloadSize;
+        }));
+    }
+}
+
+void runApiBenchmarks(const Options& options, wl::Baudrate baudrate, std::vector<Result>& results)
+{
+    const uint32_t bitsPerSecond = wl::Baudrate::getBitsPerSecond(baudrate);
+    const auto enabled = [&options](const std::string& name)
+    {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    };
+    const auto createDataLink = [&](wl::SimulatorWEOM& simulator)
+    {
+        return etl::unique_ptr<wl::IDataLinkInterface>(new wl::SimulatorDataLinkInterface(simulator, bitsPerSecond, options.turnaroundLatency));
+    };
+
+    wl::SimulatorWEOM simulator;
+    wl::WEOM weom([](const wl::Clock::duration& duration)
+    {
+        std::this_thread::sleep_for(duration);
+    });
+    if (const auto result = weom.setDataLinkInterface(createDataLink(simulator)); !result.has_value())
+    {
+        results.push_back(Result {"connect", "api", bitsPerSecond, {}, result.error().c_str()});
+        return;
+    }
+
+    if (enabled("getter"))
+    {
+        results.push_back(measureApi("getter", bitsPerSecond, options.iterations, [&weom](size_t)
+        {
+            return getError(weom.getClipLimit());
+        }));
+    }
+    if (enabled("setter"))
+    {
+        results.push_back(measureApi("setter", bitsPerSecond, options.iterations, [&weom](size_t i)
+        {
+            return getError(weom.setClipLimit(i % 100, wl::MemoryTypeWEOM::REGISTERS_CONFIGURATION));
+        }));
+    }
+    if (enabled("snapshot"))
+    {
+        results.push_back(measureApi("snapshot", bitsPerSecond, options.iterations, [&weom](size_t)
+        {
+            return getError(weom.readSnapshot());
+        }));
+    }
+    if (enabled("reconnect"))
+    {
+        results.push_back(measureApi("reconnect", bitsPerSecond, options.iterations, [&weom, &simulator, &createDataLink](size_t)
+        {
+            return getError(weom.setDataLinkInterface(createDataLink(simulator)));
+        }));
+    }
+}
+
+void writeJson(std::ostream& stream, const Options& options, const std::vector<Result>& results)
+{
+    stream << "{\n"
+           << "  \"unit\": \"ns\",\n"
+           << "  \"turnaround_us\": " << options.turnaroundLatency.count() << ",\n"
+           << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+        const auto distribution = getDistribution(result.samples);
+
+        stream << (i == 0 ? "\n" : ",\n")
+               << "    {\"name\": \"" << escapeJson(result.name) << "\", \"group\": \"" << result.group << "\", "
+               << "\"baudrate\": " << result.baudrate << ", \"iterations\": " << distribution.count;
+        if (distribution.count > 0)
+        {
+            stream << ", \"mean\": " << distribution.mean
+                   << ", \"median\": " << distribution.median
+                   << ", \"min\": " << distribution.minimum
+                   << ", \"p95\": " << distribution.p95
+                   << ", \"max\": " << distribution.maximum;
+        }
+        if (!result.error.empty())
+        {
+            stream << ", \"error\": \"" << escapeJson(result.error) << "\"";
+        }
+        stream << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    const OptionHandlers handlers = {
+        {"--iterations", [&options](const std::string& value) { options.iterations = std::max<size_t>(1, std::strtoul(value.c_str(), nullptr, 10)); }},
+        {"--turnaround-us", [&options](const std::string& value) { options.turnaroundLatency = std::chrono::microseconds(std::strtoul(value.c_str(), nullptr, 10)); }},
+        {"--filter", [&options](const std::string& value) { options.filter = value; }},
+        {"--output", [&options](const std::string& value) { options.outputPath = value; }},
+    };
+    if (!parseOptions(argc, argv, handlers))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Result> results;
+    runCodecBenchmarks(options, results);
+    for (const auto baudrate : {wl::Baudrate::B_115200, wl::Baudrate::B_921600, wl::Baudrate::B_3000000})
+    {
+        runApiBenchmarks(options, baudrate, results);
+    }
+
+    if (!writeOutput(options.outputPath, [&options, &results](std::ostream& stream) { writeJson(stream, options, results); }))
+    {
+        return EXIT_FAILURE;
+    }
+
+    const bool failed = std::any_of(results.begin(), results.end(), [](const Result& result)
+    {
+        return !result.error.empty();
+    });
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,233 @@
+#include "benchmark/benchmarkcommon.h"
+#include "simulator/faultinjectiondatalinkinterface.h"
+#include "simulator/simulatordatalinkinterface.h"
+#include "simulator/simulatorweom.h"
+
+#include "wl/weom.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace wl::benchmark;
+
+using BenchmarkClock = std::chrono::steady_clock;
+using FaultProfile = wl::FaultInjectionDataLinkInterface::FaultProfile;
+
+struct Options
+{
+    size_t calls = 200;
+    uint32_t seed = 1;
+    double probability = 0.05;
+    std::chrono::microseconds turnaroundLatency {100};
+    std::string filter;
+    std::string outputPath;
+};
+
+struct Scenario
+{
+    std::string name;
+    FaultProfile profile;
+};
+
+struct Result
+{
+    std::string name;
+    size_t calls = 0;
+    size_t succeededCalls = 0;
+    size_t faultedCalls = 0;                 // calls during which a fault was injected
+    uint64_t injectedFaults = 0;
+    std::vector<double> recoveryTimes;       // milliseconds from the start of a faulted call to the end of the next successful call
+    std::vector<double> cleanCallTimes;      // milliseconds of calls without faults
+    wl::WEOM::Statistics statistics;
+    std::string error;
+};
+
+void printUsage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--calls <count>] [--seed <seed>] [--probability <per response>] [--turnaround-us <microseconds>]"
+              << " [--filter <substring>] [--output <file>]\n"
+              << "Measures recovery of WEOMlink from faults injected into the responses of the simulated device, results are printed as JSON.\n";
+}
+
+std::vector<Scenario> getScenarios(double probability)
+{
+    std::vector<Scenario> scenarios(9);
+    scenarios[0].name = "none";
+    scenarios[1].name = "byte_drop";
+    scenarios[1].profile.byteDropProbability = probability;
+    scenarios[2].name = "bit_flip";
+    scenarios[2].profile.bitFlipProbability = probability;
+    scenarios[3].name = "truncation";
+    scenarios[3].profile.truncationProbability = probability;
+    scenarios[4].name = "duplicate";
+    scenarios[4].profile.duplicateProbability = probability;
+    scenarios[5].name = "stale";
+    scenarios[5].profile.staleProbability = probability;
+    scenarios[6].name = "stall";
+    scenarios[6].profile.stallProbability = probability;
+    // a storm costs several busy delays, keep the scenario short
+    scenarios[7].name = "not_ready";
+    scenarios[7].profile.notReadyProbability = probability / 5;
+    scenarios[8].name = "mixed";
+    scenarios[8].profile.byteDropProbability = probability / 6;
+    scenarios[8].profile.bitFlipProbability = probability / 6;
+    scenarios[8].profile.truncationProbability = probability / 6;
+    scenarios[8].profile.duplicateProbability = probability / 6;
+    scenarios[8].profile.staleProbability = probability / 6;
+    scenarios[8].profile.stallProbability = probability / 6;
+    return scenarios;
+}
+
+Result runScenario(const Options& options, const Scenario& scenario)
+{
+    static constexpr uint32_t BAUDRATE = 921'600;
+
+    Result result;
+    result.name = scenario.name;
+
+    wl::SimulatorWEOM simulator;
+    wl::WEOM weom([](const wl::Clock::duration& duration)
+    {
+        std::this_thread::sleep_for(duration);
+    });
+
+    auto simulatorDataLink = etl::unique_ptr<wl::IDataLinkInterface>(new wl::SimulatorDataLinkInterface(simulator, BAUDRATE, options.turnaroundLatency));
+    auto* faultInjection = new wl::FaultInjectionDataLinkInterface(etl::move(simulatorDataLink), FaultProfile(), options.seed);
+    if (const auto connectResult = weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(faultInjection)); !connectResult.has_value())
+    {
+        result.error = connectResult.error().c_str();
+        return result;
+    }
+    faultInjection->setFaultProfile(scenario.profile);
+    weom.resetStatistics();
+
+    std::optional<BenchmarkClock::time_point> faultTime;
+    for (size_t i = 0; i < options.calls; ++i)
+    {
+        const auto faultsBefore = faultInjection->getInjectedFaultsCount();
+        const auto start = BenchmarkClock::now();
+        const bool succeeded = i % 2 == 0 ? weom.getClipLimit().has_value() :
+                                            weom.setClipLimit(i % 100, wl::MemoryTypeWEOM::REGISTERS_CONFIGURATION).has_value();
+        const auto end = BenchmarkClock::now();
+        const bool faulted = faultInjection->getInjectedFaultsCount() != faultsBefore;
+
+        ++result.calls;
+        result.succeededCalls += succeeded ? 1 : 0;
+        result.faultedCalls += faulted ? 1 : 0;
+        if (faulted && !faultTime.has_value())
+        {
+            faultTime = start;
+        }
+
+        if (succeeded && faultTime.has_value())
+        {
+            result.recoveryTimes.push_back(std::chrono::duration<double, std::milli>(end - faultTime.value()).count());
+            faultTime.reset();
+        }
+        else if (succeeded && !faulted)
+        {
+            result.cleanCallTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+    }
+    if (faultTime.has_value())
+    {
+        result.error = "not recovered at the end";
+    }
+
+    result.injectedFaults = faultInjection->getInjectedFaultsCount();
+    result.statistics = weom.getStatistics();
+    return result;
+}
+
+void writeDistribution(std::ostream& stream, const std::string& name, const std::vector<double>& samples)
+{
+    const auto distribution = getDistribution(samples);
+    stream << ", \"" << name << "\": {\"count\": " << distribution.count;
+    if (distribution.count > 0)
+    {
+        stream << ", \"mean\": " << distribution.mean
+               << ", \"median\": " << distribution.median
+               << ", \"p95\": " << distribution.p95
+               << ", \"max\": " << distribution.maximum;
+    }
+    stream << "}";
+}
+
+void writeJson(std::ostream& stream, const Options& options, const std::vector<Result>& results)
+{
+    stream << "{\n"
+           << "  \"unit\": \"ms\",\n"
+           << "  \"seed\": " << options.seed << ",\n"
+           << "  \"probability\": " << options.probability << ",\n"
+           << "  \"statistics_enabled\": " << (wl::STATISTICS_ENABLED ? "true" : "false") << ",\n"
+           << "  \"scenarios\": [";
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& result = results[i];
+        stream << (i == 0 ? "\n" : ",\n")
+               << "    {\"name\": \"" << escapeJson(result.name) << "\", \"calls\": " << result.calls
+               << ", \"success_rate\": " << (result.calls > 0 ? double(result.succeededCalls) / result.calls : 0.0)
+               << ", \"faulted_calls\": " << result.faultedCalls << ", \"injected_faults\": " << result.injectedFaults;
+        writeDistribution(stream, "time_to_recover", result.recoveryTimes);
+        writeDistribution(stream, "clean_call", result.cleanCallTimes);
+        stream << ", \"retries\": " << result.statistics.device.retriesCount
+               << ", \"busy_sleeps\": " << result.statistics.device.busySleepsCount
+               << ", \"dropped_data\": " << result.statistics.protocol.droppedDataCount
+               << ", \"connection_lost\": " << result.statistics.protocol.connectionLostCount;
+        if (!result.error.empty())
+        {
+            stream << ", \"error\": \"" << escapeJson(result.error) << "\"";
+        }
+        stream << "}";
+    }
+    stream << "\n  ]\n}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    const OptionHandlers handlers = {
+        {"--calls", [&options](const std::string& value) { options.calls = std::max<size_t>(1, std::strtoul(value.c_str(), nullptr, 10)); }},
+        {"--seed", [&options](const std::string& value) { options.seed = std::strtoul(value.c_str(), nullptr, 10); }},
+        {"--probability", [&options](const std::string& value) { options.probability = std::clamp(std::strtod(value.c_str(), nullptr), 0.0, 1.0); }},
+        {"--turnaround-us", [&options](const std::string& value) { options.turnaroundLatency = std::chrono::microseconds(std::strtoul(value.c_str(), nullptr, 10)); }},
+        {"--filter", [&options](const std::string& value) { options.filter = value; }},
+        {"--output", [&options](const std::string& value) { options.outputPath = value; }},
+    };
+    if (!parseOptions(argc, argv, handlers))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<Result> results;
+    for (const auto& scenario : getScenarios(options.probability))
+    {
+        if (options.filter.empty() || scenario.name.find(options.filter) != std::string::npos)
+        {
+            results.push_back(runScenario(options, scenario));
+        }
+    }
+
+    if (!writeOutput(options.outputPath, [&options, &results](std::ostream& stream) { writeJson(stream, options, results); }))
+    {
+        return EXIT_FAILURE;
+    }
+
+    const bool failed = std::any_of(results.begin(), results.end(), [](const Result& result)
+    {
+        return !result.error.empty();
+    });
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
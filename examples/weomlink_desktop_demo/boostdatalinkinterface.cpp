@@ -2,6 +2,8 @@
 
 #include "elapsedtimer.h"
 
+#include <iostream>
+
 BoostDataLinkInterface::BoostDataLinkInterface()
     : m_ioContext()
     , m_serialPort(nullptr)
@@ -164,6 +166,42 @@ bool BoostDataLinkInterface::isConnectionLost() const
 
 }
 
+uint32_t BoostDataLinkInterface::getBaudrate() const
+{
+    if (!m_serialPort)
+    {
+        return 0;
+    }
+
+    boost::asio::serial_port_base::baud_rate baudrate;
+    boost::system::error_code errorCode;
+    m_serialPort->get_option(baudrate, errorCode);
+    return errorCode.failed() ? 0 : baudrate.value();
+}
+
+bool BoostDataLinkInterface::isBaudrateSupported(uint32_t baudrate) const
+{
+    // the serial adapter decides, setBaudrate reports a rejected speed
+    return m_serialPort && baudrate != 0;
+}
+
+etl::expected<void, wl::Error> BoostDataLinkInterface::setBaudrate(uint32_t baudrate)
+{
+    if (!m_serialPort)
+    {
+        return etl::unexpected<wl::Error>(wl::Error::DATALINK__NO_CONNECTION);
+    }
+
+    boost::system::error_code errorCode;
+    m_serialPort->set_option(boost::asio::serial_port_base::baud_rate(baudrate), errorCode);
+    if (errorCode.failed())
+    {
+        return etl::unexpected<wl::Error>(wl::Error::DATALINK__UNSUPPORTED_BAUDRATE);
+    }
+    dropPendingData();
+    return {};
+}
+
 bool BoostDataLinkInterface::isConnectionLostIndicator(boost::system::error_code errorCode) const
 {
     return errorCode == make_error_code(boost::asio::error::no_permission) // for windows
@@ -22,6 +22,9 @@ public:
 
     virtual void dropPendingData() override;
     virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+    virtual etl::expected<void, wl::Error> setBaudrate(uint32_t baudrate) override;
 
 private:
     boost::asio::io_context m_ioContext;
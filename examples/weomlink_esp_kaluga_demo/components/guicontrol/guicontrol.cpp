@@ -90,121 +90,29 @@ void GuiControl::initizalizeMenu()
 {
     ESP_LOGI(TAG, "Creating menu");
 
-    auto contrastBrightness = m_coreControl->getMgcContrastBrightness();
-    if (!contrastBrightness.has_value())
+    auto snapshot = m_coreControl->readSnapshot();
+    if (!snapshot.has_value())
     {
-        ESP_LOGE(TAG, "Failed to read contrast and brightness (%s)", contrastBrightness.error().c_str());
+        ESP_LOGE(TAG, "Failed to read configuration (%s)", snapshot.error().c_str());
         return;
     }
 
-    m_contrastBrightness = contrastBrightness.value();
-
-    auto imageFlip = m_coreControl->getImageFlip();
-    if (!imageFlip.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read image flip (%s)", imageFlip.error().c_str());
-        return;
-    }
-
-    m_imageFlip = imageFlip.value();
-
-    auto serialNumber = m_coreControl->getSerialNumber();
-    if (!serialNumber.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read serial number (%s)", serialNumber.error().c_str());
-        return;
-    }
-
-    auto articleNumber = m_coreControl->getArticleNumber();
-    if (!articleNumber.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read article number (%s)", articleNumber.error().c_str());
-        return;
-    }
-
-    auto firmwareVersion = m_coreControl->getFirmwareVersion();
-    if (!firmwareVersion.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read firmwareVersion (%s)", firmwareVersion.error().c_str());
-        return;
-    }
-    
-    auto paletteIndex = m_coreControl->getPaletteIndex();
-    if (!paletteIndex.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read paletteIndex (%s)", paletteIndex.error().c_str());
-        return;
-    }
-
-    auto frameRate = m_coreControl->getFramerate();
-    if (!frameRate.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read frame rate (%s)", frameRate.error().c_str());
-        return;
-    }
-
-    auto imageFreeze = m_coreControl->getImageFreeze();
-    if (!imageFreeze.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read image freeze (%s)", imageFreeze.error().c_str());
-        return;
-    }
-
-    auto imageGenerator = m_coreControl->getImageGenerator();
-    if (!imageGenerator.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read image generator (%s)", imageGenerator.error().c_str());
-        return;
-    }
-
-    auto shutterUpdateMode = m_coreControl->getShutterUpdateMode();
-    if (!shutterUpdateMode.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read shutter update mode (%s)", shutterUpdateMode.error().c_str());
-        return;
-    }
-
-    auto timeDomainAveraging = m_coreControl->getTimeDomainAveraging();
-    if (!timeDomainAveraging.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read time domain averaging (%s)", timeDomainAveraging.error().c_str());
-        return;
-    }
-
-    auto imageEqualizationType = m_coreControl->getImageEqualizationType();
-    if (!imageEqualizationType.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read image equalization type (%s)", imageEqualizationType.error().c_str());
-        return;
-    }
-
-    auto agcNhSmoothingFrames = m_coreControl->getAgcNhSmoothingFrames();
-    if (!agcNhSmoothingFrames.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read article AGC NH smoothing frames (%s)", agcNhSmoothingFrames.error().c_str());
-        return;
-    }
-
-    auto spatialMedianFilterEnabled = m_coreControl->getSpatialMedianFilterEnabled();
-    if (!spatialMedianFilterEnabled.has_value())
-    {
-        ESP_LOGE(TAG, "Failed to read spatial median filter enabled (%s)", spatialMedianFilterEnabled.error().c_str());
-        return;
-    }
+    m_contrastBrightness = snapshot.value().mgcContrastBrightness;
+    m_imageFlip = snapshot.value().imageFlip;
 
     std::vector<MenuLine> menuDefinition = 
     {
-        {"Serial number", std::make_shared<LabelMenuItem<wl::WEOM::SERIAL_NUMBER_STRING_SIZE>>(serialNumber.value().c_str())},
-        {"Article number", std::make_shared<LabelMenuItem<wl::WEOM::SERIAL_NUMBER_STRING_SIZE>>(articleNumber.value().c_str())},
-        {"FW version", std::make_shared<LabelMenuItem<wl::FirmwareVersion::MAXIMUM_STRING_SIZE>>(firmwareVersion.value().toString().c_str())},
+        {"Serial number", std::make_shared<LabelMenuItem<wl::WEOM::SERIAL_NUMBER_STRING_SIZE>>(snapshot.value().serialNumber.c_str())},
+        {"Article number", std::make_shared<LabelMenuItem<wl::WEOM::SERIAL_NUMBER_STRING_SIZE>>(snapshot.value().articleNumber.c_str())},
+        {"FW version", std::make_shared<LabelMenuItem<wl::FirmwareVersion::MAXIMUM_STRING_SIZE>>(snapshot.value().firmwareVersion.toString().c_str())},
         {"Palette", std::make_shared<SpinBoxMenuItem>(0, 15, 1, 
-                                                      static_cast<int>(paletteIndex.value()), 
+                                                      static_cast<int>(snapshot.value().paletteIndex), 
                                                       [this](int index) -> bool
                                                       {
                                                          return m_coreControl->setPaletteIndex(static_cast<uint8_t>(index));
                                                       })},
         {"Framerate", std::make_shared<ComboBoxMenuItem<3>>(etl::make_vector<const char*>("9 Hz", "30 Hz", "60 Hz"), 
-                                                         static_cast<int>(frameRate.value()), 
+                                                         static_cast<int>(snapshot.value().framerate), 
                                                          [this](int index) -> bool
                                                          {
                                                             return m_coreControl->setFramerate(static_cast<wl::Framerate>(index));
@@ -224,31 +132,31 @@ void GuiControl::initizalizeMenu()
                                                               return m_coreControl->setImageFlip(m_imageFlip);
                                                           })},
         {"Image freeze", std::make_shared<ComboBoxMenuItem<2>>(etl::make_vector<const char*>("OFF", "ON"), 
-                                                            imageFreeze.value() ? 1 : 0,  
+                                                            snapshot.value().imageFreeze ? 1 : 0,  
                                                             [this](int index) -> bool
                                                             {
                                                                return m_coreControl->setImageFreeze(index == 1);
                                                             })},
         {"Image source", std::make_shared<ComboBoxMenuItem<2>>(etl::make_vector<const char*>("Sensor", "Pattern"), 
-                                                            static_cast<int>(imageGenerator.value()), 
+                                                            static_cast<int>(snapshot.value().imageGenerator), 
                                                             [this](int index) -> bool
                                                             {
                                                                return m_coreControl->setImageGenerator(static_cast<wl::ImageGenerator>(index));
                                                             })},
         {"NUC update mode", std::make_shared<ComboBoxMenuItem<2>>(etl::make_vector<const char*>("Periodic", "Adaptive"), 
-                                                               static_cast<int>(shutterUpdateMode.value()) - 1, 
+                                                               static_cast<int>(snapshot.value().shutterUpdateMode) - 1, 
                                                                [this](int index) -> bool
                                                                {
                                                                   return m_coreControl->setShutterUpdateMode(static_cast<wl::ShutterUpdateMode>(index + 1));
                                                                })},
         {"Time domain average", std::make_shared<ComboBoxMenuItem<3>>(etl::make_vector<const char*>("OFF", "2 frames", "4 frames"), 
-                                                                   static_cast<int>(timeDomainAveraging.value()),
+                                                                   static_cast<int>(snapshot.value().timeDomainAveraging),
                                                                    [this](int index) -> bool
                                                                    {
                                                                       return m_coreControl->setTimeDomainAveraging(static_cast<wl::TimeDomainAveraging>(index));
                                                                    })},
         {"Image equalization", std::make_shared<ComboBoxMenuItem<2>>(etl::make_vector<const char*>("AGC", "MGC"), 
-                                                                  static_cast<int>(imageEqualizationType.value()),
+                                                                  static_cast<int>(snapshot.value().imageEqualizationType),
                                                                   [this](int index) -> bool
                                                                   {
                                                                      return m_coreControl->setImageEqualizationType(static_cast<wl::ImageEqualizationType>(index));
@@ -268,13 +176,13 @@ void GuiControl::initizalizeMenu()
                                                              return m_coreControl->setMgcContrastBrightness(m_contrastBrightness);
                                                          })},
         {"AGC NH smoothing", std::make_shared<ComboBoxMenuItem<5>>(etl::make_vector<const char*>("1 frame", "2 frames", "4 frames", "8 frames", "16 frames"), 
-                                                                static_cast<int>(agcNhSmoothingFrames.value()),
+                                                                static_cast<int>(snapshot.value().agcNhSmoothingFrames),
                                                                 [this](int index) -> bool
                                                                 {
                                                                    return m_coreControl->setAgcNhSmoothingFrames(static_cast<uint8_t>(index));
                                                                 })},
         {"Spatial median filter", std::make_shared<ComboBoxMenuItem<2>>(etl::make_vector<const char*>("OFF", "ON"), 
-                                                                     spatialMedianFilterEnabled.value() ? 1 : 0,
+                                                                     snapshot.value().spatialMedianFilterEnabled ? 1 : 0,
                                                                      [this](int index) -> bool
                                                                      {
                                                                         return m_coreControl->setSpatialMedianFilterEnabled(index == 1);
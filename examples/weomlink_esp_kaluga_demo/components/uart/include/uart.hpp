@@ -28,6 +28,8 @@ public:
     virtual void dropPendingData() override;
 
     virtual bool isConnectionLost() const override;
+
+    virtual uint32_t getBaudrate() const override;
 private:
     static constexpr uart_port_t UART_PORT = UART_NUM_1;
     static constexpr int UART_BUFFER_SIZE = 256;
@@ -109,3 +109,13 @@ bool Uart::isConnectionLost() const
 {
     return false;
 }
+
+uint32_t Uart::getBaudrate() const
+{
+    uint32_t baudrate = 0;
+    if (uart_get_baudrate(UART_PORT, &baudrate) != ESP_OK)
+    {
+        return 0;
+    }
+    return baudrate;
+}
@@ -0,0 +1,261 @@
+#include "simulator/faultinjectiondatalinkinterface.h"
+
+#include "wl/communication/tcsipacket.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+namespace wl {
+
+FaultInjectionDataLinkInterface::FaultInjectionDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface, const FaultProfile& profile, uint32_t seed) :
+    m_dataLinkInterface(etl::move(dataLinkInterface)),
+    m_profile(profile),
+    m_random(seed)
+{
+}
+
+bool FaultInjectionDataLinkInterface::isOpened() const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isOpened();
+}
+
+void FaultInjectionDataLinkInterface::closeConnection()
+{
+    m_pendingData.clear();
+    if (m_dataLinkInterface)
+    {
+        m_dataLinkInterface->closeConnection();
+    }
+}
+
+size_t FaultInjectionDataLinkInterface::getMaxDataSize() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getMaxDataSize() : 0;
+}
+
+etl::expected<void, Error> FaultInjectionDataLinkInterface::read(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto deadline = Clock::now() + timeout;
+    while (m_pendingData.size() < buffer.size())
+    {
+        if (const auto result = receiveFrame(deadline); !result.has_value())
+        {
+            return result;
+        }
+    }
+
+    if (m_pendingDataArrivalTime > deadline)
+    {
+        // stalled response, the bytes stay pending until they arrive or are dropped
+        std::this_thread::sleep_until(deadline);
+        return etl::unexpected<Error>(Error::DATALINK__TIMEOUT);
+    }
+    std::this_thread::sleep_until(m_pendingDataArrivalTime);
+
+    std::copy_n(m_pendingData.begin(), buffer.size(), buffer.begin());
+    m_pendingData.erase(m_pendingData.begin(), m_pendingData.begin() + buffer.size());
+    return {};
+}
+
+etl::expected<void, Error> FaultInjectionDataLinkInterface::write(etl::span<const uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    return m_dataLinkInterface->write(buffer, timeout);
+}
+
+etl::expected<void, Error> FaultInjectionDataLinkInterface::writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    return m_dataLinkInterface->writeGather(buffers, timeout);
+}
+
+void FaultInjectionDataLinkInterface::dropPendingData()
+{
+    m_pendingData.clear();
+    m_pendingDataArrivalTime = {};
+    if (m_dataLinkInterface)
+    {
+        m_dataLinkInterface->dropPendingData();
+    }
+}
+
+bool FaultInjectionDataLinkInterface::isConnectionLost() const
+{
+    return !m_dataLinkInterface || m_dataLinkInterface->isConnectionLost();
+}
+
+uint32_t FaultInjectionDataLinkInterface::getBaudrate() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getBaudrate() : 0;
+}
+
+bool FaultInjectionDataLinkInterface::isBaudrateSupported(uint32_t baudrate) const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isBaudrateSupported(baudrate);
+}
+
+etl::expected<void, Error> FaultInjectionDataLinkInterface::setBaudrate(uint32_t baudrate)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    m_pendingData.clear();
+    m_pendingDataArrivalTime = {};
+    return m_dataLinkInterface->setBaudrate(baudrate);
+}
+
+void FaultInjectionDataLinkInterface::setFaultProfile(const FaultProfile& profile)
+{
+    m_profile = profile;
+}
+
+uint64_t FaultInjectionDataLinkInterface::getInjectedFaultsCount(Fault fault) const
+{
+    return m_injectedFaultsCounts.at(static_cast<size_t>(fault));
+}
+
+uint64_t FaultInjectionDataLinkInterface::getInjectedFaultsCount() const
+{
+    return std::accumulate(m_injectedFaultsCounts.begin(), m_injectedFaultsCounts.end(), uint64_t(0));
+}
+
+const char* FaultInjectionDataLinkInterface::getFaultName(Fault fault)
+{
+    switch (fault)
+    {
+        case Fault::BYTE_DROP:
+            return "byte_drop";
+        case Fault::BIT_FLIP:
+            return "bit_flip";
+        case Fault::TRUNCATION:
+            return "truncation";
+        case Fault::DUPLICATE:
+            return "duplicate";
+        case Fault::STALE:
+            return "stale";
+        case Fault::STALL:
+            return "stall";
+        case Fault::NOT_READY:
+            return "not_ready";
+    }
+    return "";
+}
+
+etl::expected<void, Error> FaultInjectionDataLinkInterface::receiveFrame(const Clock::time_point& deadline)
+{
+    // the count of payload bytes is the last byte of the header, the checksum follows the payload
+    std::vector<uint8_t> frame(TCSIPacket::HEADER_SIZE);
+    if (const auto result = readFromDataLink(frame, deadline); !result.has_value())
+    {
+        return result;
+    }
+    frame.resize(TCSIPacket::MINIMUM_PACKET_SIZE + frame.at(TCSIPacket::HEADER_SIZE - 1));
+    if (const auto result = readFromDataLink(etl::span<uint8_t>(frame).subspan(TCSIPacket::HEADER_SIZE), deadline); !result.has_value())
+    {
+        return result;
+    }
+
+    const auto originalFrame = frame;
+    injectFault(frame);
+    m_previousFrame = originalFrame;
+
+    if (m_pendingData.empty())
+    {
+        m_pendingDataArrivalTime = std::max(m_pendingDataArrivalTime, Clock::now());
+    }
+    m_pendingData.insert(m_pendingData.end(), frame.begin(), frame.end());
+    return {};
+}
+
+etl::expected<void, Error> FaultInjectionDataLinkInterface::readFromDataLink(etl::span<uint8_t> buffer, const Clock::time_point& deadline)
+{
+    const auto timeout = std::max(Clock::duration::zero(), deadline - Clock::now());
+    return m_dataLinkInterface->read(buffer, timeout);
+}
+
+void FaultInjectionDataLinkInterface::injectFault(std::vector<uint8_t>& frame)
+{
+    const auto count = [this](Fault fault)
+    {
+        ++m_injectedFaultsCounts.at(static_cast<size_t>(fault));
+    };
+    const auto randomIndex = [this](size_t size)
+    {
+        return std::uniform_int_distribution<size_t>(0, size - 1)(m_random);
+    };
+
+    if (m_notReadyRemainingCount > 0)
+    {
+        --m_notReadyRemainingCount;
+        frame = createNotReadyResponse(frame);
+        return;
+    }
+
+    double draw = std::uniform_real_distribution<double>(0.0, 1.0)(m_random);
+    const auto drawn = [&draw](double probability)
+    {
+        draw -= probability;
+        return draw < 0.0;
+    };
+
+    if (drawn(m_profile.byteDropProbability))
+    {
+        frame.erase(frame.begin() + randomIndex(frame.size()));
+        count(Fault::BYTE_DROP);
+    }
+    else if (drawn(m_profile.bitFlipProbability))
+    {
+        frame.at(randomIndex(frame.size())) ^= static_cast<uint8_t>(1 << randomIndex(8));
+        count(Fault::BIT_FLIP);
+    }
+    else if (drawn(m_profile.truncationProbability))
+    {
+        frame.resize(1 + randomIndex(frame.size() - 1));
+        count(Fault::TRUNCATION);
+    }
+    else if (drawn(m_profile.duplicateProbability))
+    {
+        const auto copy = frame;
+        frame.insert(frame.end(), copy.begin(), copy.end());
+        count(Fault::DUPLICATE);
+    }
+    else if (drawn(m_profile.staleProbability) && !m_previousFrame.empty())
+    {
+        frame.insert(frame.begin(), m_previousFrame.begin(), m_previousFrame.end());
+        count(Fault::STALE);
+    }
+    else if (drawn(m_profile.stallProbability))
+    {
+        m_pendingDataArrivalTime = std::max(m_pendingDataArrivalTime, Clock::now() + m_profile.stallDuration);
+        count(Fault::STALL);
+    }
+    else if (drawn(m_profile.notReadyProbability))
+    {
+        m_notReadyRemainingCount = m_profile.notReadyBurstLength > 0 ? m_profile.notReadyBurstLength - 1 : 0;
+        frame = createNotReadyResponse(frame);
+        count(Fault::NOT_READY);
+    }
+}
+
+std::vector<uint8_t> FaultInjectionDataLinkInterface::createNotReadyResponse(const std::vector<uint8_t>& frame) const
+{
+    auto frameCopy = frame;
+    const TCSIPacket response(frameCopy);
+    const auto notReadyResponse = TCSIPacket::createErrorResponse(response.getPacketId(), response.getAddress(), TCSIPacket::Status::CAMERA_NOT_READY);
+    return std::vector<uint8_t>(notReadyResponse.getPacketData().begin(), notReadyResponse.getPacketData().end());
+}
+
+} // namespace wl
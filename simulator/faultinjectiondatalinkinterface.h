@@ -0,0 +1,136 @@
+#ifndef WL_FAULTINJECTIONDATALINKINTERFACE_H
+#define WL_FAULTINJECTIONDATALINKINTERFACE_H
+
+#include "wl/communication/idatalinkinterface.h"
+
+#include <etl/memory.h>
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace wl {
+
+/**
+ * @class FaultInjectionDataLinkInterface
+ * @headerfile faultinjectiondatalinkinterface.h "simulator/faultinjectiondatalinkinterface.h"
+ * @brief Data link decorator corrupting the responses of the wrapped data link, used to measure recovery of WEOMlink.
+ *
+ * @details
+ * Responses are taken from the wrapped data link as whole TCSI frames (it has to deliver complete frames, e.g.
+ * SimulatorDataLinkInterface) and each frame gets at most one fault drawn from the FaultProfile probabilities.
+ * The random generator is seeded, so a profile and seed reproduce the same faults for the same conversation.
+ * Requests are passed through unchanged.
+ * @code
+ * wl::FaultInjectionDataLinkInterface::FaultProfile profile;
+ * profile.bitFlipProbability = 0.05;
+ * auto dataLink = etl::unique_ptr<wl::IDataLinkInterface>(new wl::SimulatorDataLinkInterface(simulator, 921600));
+ * auto result = weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(new wl::FaultInjectionDataLinkInterface(etl::move(dataLink), profile, 1)));
+ * @endcode
+ */
+class FaultInjectionDataLinkInterface : public IDataLinkInterface
+{
+public:
+    /**
+     * @enum Fault
+     * @brief Kinds of injected faults.
+     */
+    enum class Fault : uint8_t
+    {
+        BYTE_DROP,  ///< One byte of the response is lost.
+        BIT_FLIP,   ///< One bit of the response is inverted.
+        TRUNCATION, ///< The end of the response is lost.
+        DUPLICATE,  ///< The response arrives twice.
+        STALE,      ///< The previous response arrives again before the response.
+        STALL,      ///< The response arrives after FaultProfile::stallDuration.
+        NOT_READY,  ///< The response and FaultProfile::notReadyBurstLength - 1 following ones are replaced by CAMERA_NOT_READY responses.
+    };
+    static constexpr size_t FAULTS_COUNT = static_cast<size_t>(Fault::NOT_READY) + 1;
+
+    /**
+     * @struct FaultProfile
+     * @brief Probabilities of the faults per response frame, their sum should not exceed 1.
+     */
+    struct FaultProfile
+    {
+        double byteDropProbability {0.0};
+        double bitFlipProbability {0.0};
+        double truncationProbability {0.0};
+        double duplicateProbability {0.0};
+        double staleProbability {0.0};
+        double stallProbability {0.0};
+        double notReadyProbability {0.0};
+        Clock::duration stallDuration {std::chrono::milliseconds(200)}; ///< Delay of a stalled response.
+        uint32_t notReadyBurstLength {5};                               ///< Number of responses replaced by one NOT_READY fault.
+    };
+
+    /**
+     * @brief Constructs the decorator.
+     * @param dataLinkInterface The wrapped data link.
+     * @param profile Probabilities of the faults.
+     * @param seed Seed of the random generator.
+     */
+    FaultInjectionDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface, const FaultProfile& profile, uint32_t seed);
+
+    virtual bool isOpened() const override;
+    virtual void closeConnection() override;
+    virtual size_t getMaxDataSize() const override;
+
+    virtual etl::expected<void, Error> read(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout) override;
+
+    virtual void dropPendingData() override;
+    virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+    virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) override;
+
+    /**
+     * @brief Changes the probabilities of the following faults, e.g. to connect without faults first.
+     * @param profile Probabilities of the faults.
+     */
+    void setFaultProfile(const FaultProfile& profile);
+
+    /**
+     * @brief Retrieves the number of injected faults of a kind.
+     * @param fault Kind of the fault.
+     * @return Number of faults since construction.
+     */
+    uint64_t getInjectedFaultsCount(Fault fault) const;
+
+    /**
+     * @brief Retrieves the number of injected faults of all kinds.
+     * @return Number of faults since construction.
+     */
+    uint64_t getInjectedFaultsCount() const;
+
+    /**
+     * @brief Retrieves the name of a fault.
+     * @param fault Kind of the fault.
+     * @return Lower case name, e.g. "bit_flip".
+     */
+    static const char* getFaultName(Fault fault);
+
+private:
+    [[nodiscard]] etl::expected<void, Error> receiveFrame(const Clock::time_point& deadline);
+    [[nodiscard]] etl::expected<void, Error> readFromDataLink(etl::span<uint8_t> buffer, const Clock::time_point& deadline);
+    void injectFault(std::vector<uint8_t>& frame);
+    std::vector<uint8_t> createNotReadyResponse(const std::vector<uint8_t>& frame) const;
+
+    etl::unique_ptr<IDataLinkInterface> m_dataLinkInterface;
+    FaultProfile m_profile;
+    std::mt19937 m_random;
+
+    std::deque<uint8_t> m_pendingData;
+    Clock::time_point m_pendingDataArrivalTime {};
+    std::vector<uint8_t> m_previousFrame;
+    uint32_t m_notReadyRemainingCount {0};
+    std::array<uint64_t, FAULTS_COUNT> m_injectedFaultsCounts {};
+};
+
+} // namespace wl
+
+#endif // WL_FAULTINJECTIONDATALINKINTERFACE_H
@@ -0,0 +1,166 @@
+#include "simulator/simulatorweom.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options
+{
+    uint32_t baudrate = 115200;
+    std::chrono::microseconds turnaroundLatency {0};
+    std::chrono::milliseconds triggerBusyDuration {0};
+};
+
+void printUsage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--baudrate <bits per second>] [--turnaround-us <microseconds>] [--trigger-busy-ms <milliseconds>]\n"
+              << "Simulates a WEOM device behind a pseudo terminal, connect WEOMlink to the printed device path.\n"
+              << "Baud rate 0 sends responses without transfer delays.\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string option = argv[i];
+        if (i + 1 >= argc)
+        {
+            return false;
+        }
+
+        const unsigned long value = std::strtoul(argv[++i], nullptr, 10);
+        if (option == "--baudrate")
+        {
+            options.baudrate = value;
+        }
+        else if (option == "--turnaround-us")
+        {
+            options.turnaroundLatency = std::chrono::microseconds(value);
+        }
+        else if (option == "--trigger-busy-ms")
+        {
+            options.triggerBusyDuration = std::chrono::milliseconds(value);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool setRawMode(int fileDescriptor)
+{
+    termios attributes {};
+    if (tcgetattr(fileDescriptor, &attributes) != 0)
+    {
+        return false;
+    }
+    cfmakeraw(&attributes);
+    return tcsetattr(fileDescriptor, TCSANOW, &attributes) == 0;
+}
+
+// sends the response paced by the line speed
+bool transmit(int fileDescriptor, const std::vector<uint8_t>& data, uint32_t baudrate)
+{
+    static constexpr uint32_t BITS_PER_BYTE = 10;
+    const auto byteDuration = baudrate == 0 ? std::chrono::nanoseconds(0) : std::chrono::nanoseconds(BITS_PER_BYTE * 1'000'000'000ull / baudrate);
+
+    // chunks of about a millisecond, shorter sleeps are not precise
+    const size_t chunkSize = std::max<size_t>(1, baudrate / BITS_PER_BYTE / 1000);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset < data.size(); )
+    {
+        const size_t size = std::min(chunkSize, data.size() - offset);
+        std::this_thread::sleep_until(start + static_cast<long long>(offset + size) * byteDuration);
+        if (::write(fileDescriptor, data.data() + offset, size) != static_cast<ssize_t>(size))
+        {
+            return false;
+        }
+        offset += size;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        std::cerr << "Failed to create pseudo terminal: " << std::strerror(errno) << "\n";
+        return EXIT_FAILURE;
+    }
+
+    const char* slaveName = ptsname(master);
+    // keeping the slave side opened avoids hang-ups between client connections
+    const int slave = slaveName ? open(slaveName, O_RDWR | O_NOCTTY) : -1;
+    if (slave < 0 || !setRawMode(master) || !setRawMode(slave))
+    {
+        std::cerr << "Failed to configure pseudo terminal: " << std::strerror(errno) << "\n";
+        return EXIT_FAILURE;
+    }
+
+    wl::SimulatorWEOM simulator;
+    simulator.setTriggerBusyDuration(options.triggerBusyDuration);
+
+    std::cout << "Simulated WEOM device: " << slaveName << " (" << options.baudrate << " Bd, turnaround "
+              << options.turnaroundLatency.count() << " us)" << std::endl;
+
+    std::vector<uint8_t> buffer(1024);
+    while (true)
+    {
+        pollfd pollDescriptor {master, POLLIN, 0};
+        if (poll(&pollDescriptor, 1, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            std::cerr << "Failed to wait for data: " << std::strerror(errno) << "\n";
+            return EXIT_FAILURE;
+        }
+
+        const ssize_t size = ::read(master, buffer.data(), buffer.size());
+        if (size <= 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            continue;
+        }
+
+        simulator.receive(etl::span<const uint8_t>(buffer.data(), size));
+        if (simulator.getPendingResponseSize() == 0)
+        {
+            continue;
+        }
+
+        std::this_thread::sleep_for(options.turnaroundLatency);
+        std::vector<uint8_t> response(simulator.getPendingResponseSize());
+        simulator.transmit(response);
+        if (!transmit(master, response, options.baudrate))
+        {
+            std::cerr << "Failed to send response: " << std::strerror(errno) << "\n";
+        }
+    }
+}
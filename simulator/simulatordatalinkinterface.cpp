@@ -0,0 +1,176 @@
+#include "simulator/simulatordatalinkinterface.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace wl {
+
+SimulatorDataLinkInterface::SimulatorDataLinkInterface(SimulatorWEOM& simulator, uint32_t baudrate, const Clock::duration& turnaroundLatency) :
+    m_simulator(simulator),
+    m_baudrate(baudrate),
+    m_turnaroundLatency(turnaroundLatency)
+{
+    m_simulator.setUartBaudrate(baudrate);
+}
+
+bool SimulatorDataLinkInterface::isOpened() const
+{
+    return m_opened;
+}
+
+void SimulatorDataLinkInterface::closeConnection()
+{
+    m_opened = false;
+    dropPendingData();
+}
+
+size_t SimulatorDataLinkInterface::getMaxDataSize() const
+{
+    return std::numeric_limits<size_t>::max();
+}
+
+etl::expected<void, Error> SimulatorDataLinkInterface::read(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_opened)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto deadline = Clock::now() + timeout;
+    if (m_receivedData.size() < buffer.size() || (!buffer.empty() && m_receivedData.at(buffer.size() - 1).arrivalTime > deadline))
+    {
+        // the device sends nothing more on its own
+        std::this_thread::sleep_until(deadline);
+        return etl::unexpected<Error>(Error::DATALINK__TIMEOUT);
+    }
+
+    if (!buffer.empty())
+    {
+        std::this_thread::sleep_until(m_receivedData.at(buffer.size() - 1).arrivalTime);
+    }
+    for (auto& value : buffer)
+    {
+        value = m_receivedData.front().value;
+        m_receivedData.pop_front();
+    }
+    return {};
+}
+
+etl::expected<void, Error> SimulatorDataLinkInterface::write(etl::span<const uint8_t> buffer, const Clock::duration& timeout)
+{
+    (void)timeout;
+
+    if (!m_opened)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto byteDuration = getByteDuration();
+    m_transmitLineFreeTime = std::max(Clock::now(), m_transmitLineFreeTime) + static_cast<Clock::rep>(buffer.size()) * byteDuration;
+
+    if (m_baudrate != 0 && m_baudrate != m_simulator.getUartBaudrate())
+    {
+        // framing errors, the device receives nothing it could respond to
+        return {};
+    }
+    m_simulator.receive(buffer);
+    std::vector<uint8_t> response(m_simulator.getPendingResponseSize());
+    m_simulator.transmit(response);
+    if (response.empty())
+    {
+        return {};
+    }
+
+    auto arrivalTime = std::max(m_transmitLineFreeTime + m_turnaroundLatency, m_receiveLineFreeTime);
+    for (const auto value : response)
+    {
+        arrivalTime += byteDuration;
+        m_receivedData.push_back(ReceivedByte{value, arrivalTime});
+    }
+    m_receiveLineFreeTime = arrivalTime;
+    return {};
+}
+
+size_t SimulatorDataLinkInterface::available() const
+{
+    const auto now = Clock::now();
+    const auto firstNotArrived = std::find_if(m_receivedData.begin(), m_receivedData.end(), [now](const ReceivedByte& receivedByte)
+    {
+        return receivedByte.arrivalTime > now;
+    });
+    return firstNotArrived - m_receivedData.begin();
+}
+
+etl::expected<size_t, Error> SimulatorDataLinkInterface::readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_opened)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    if (buffer.empty())
+    {
+        return 0;
+    }
+
+    const auto deadline = Clock::now() + timeout;
+    if (m_receivedData.empty() || m_receivedData.front().arrivalTime > deadline)
+    {
+        std::this_thread::sleep_until(deadline);
+        return etl::unexpected<Error>(Error::DATALINK__TIMEOUT);
+    }
+
+    std::this_thread::sleep_until(m_receivedData.front().arrivalTime);
+    const size_t size = std::min(buffer.size(), available());
+    for (size_t i = 0; i < size; ++i)
+    {
+        buffer[i] = m_receivedData.front().value;
+        m_receivedData.pop_front();
+    }
+    return size;
+}
+
+void SimulatorDataLinkInterface::dropPendingData()
+{
+    m_receivedData.clear();
+    m_simulator.dropPendingData();
+}
+
+bool SimulatorDataLinkInterface::isConnectionLost() const
+{
+    return false;
+}
+
+uint32_t SimulatorDataLinkInterface::getBaudrate() const
+{
+    return m_baudrate;
+}
+
+bool SimulatorDataLinkInterface::isBaudrateSupported(uint32_t baudrate) const
+{
+    return baudrate != 0;
+}
+
+etl::expected<void, Error> SimulatorDataLinkInterface::setBaudrate(uint32_t baudrate)
+{
+    m_baudrate = baudrate;
+    m_receivedData.clear();
+    return {};
+}
+
+void SimulatorDataLinkInterface::setTurnaroundLatency(const Clock::duration& turnaroundLatency)
+{
+    m_turnaroundLatency = turnaroundLatency;
+}
+
+Clock::duration SimulatorDataLinkInterface::getByteDuration() const
+{
+    if (m_baudrate == 0)
+    {
+        return Clock::duration::zero();
+    }
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(BITS_PER_BYTE * 1'000'000'000ull / m_baudrate));
+}
+
+} // namespace wl
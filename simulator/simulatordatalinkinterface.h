@@ -0,0 +1,106 @@
+#ifndef WL_SIMULATORDATALINKINTERFACE_H
+#define WL_SIMULATORDATALINKINTERFACE_H
+
+#include "simulator/simulatorweom.h"
+
+#include "wl/communication/idatalinkinterface.h"
+
+#include <deque>
+
+namespace wl {
+
+/**
+ * @class SimulatorDataLinkInterface
+ * @headerfile simulatordatalinkinterface.h "simulator/simulatordatalinkinterface.h"
+ * @brief Data link connecting WEOMlink to a SimulatorWEOM in the same process.
+ *
+ * @details
+ * Transfers are timed like on a UART line: each byte takes 10 bits (8N1) at the configured baud rate
+ * in both directions and the device starts responding after the turnaround latency.
+ * Writes return immediately (like writes to a serial port buffer), reads wait until the response bytes arrive.
+ * Baud rate 0 disables the timing. Like on a real line, the device ignores requests sent at other speed than its
+ * UART_BAUDRATE_CURRENT (see SimulatorWEOM::getUartBaudrate), the constructor sets it to the given baud rate.
+ *
+ * The simulator is not owned and has to outlive the data link.
+ * @code
+ * wl::SimulatorWEOM simulator;
+ * wl::WEOM weom(sleepFunction);
+ * auto result = weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(new wl::SimulatorDataLinkInterface(simulator, 921600)));
+ * @endcode
+ */
+class SimulatorDataLinkInterface : public IDataLinkInterface
+{
+public:
+    /**
+     * @brief Constructs a data link to the simulator.
+     * @param simulator The simulated device.
+     * @param baudrate Line speed in bits per second, 0 for no transfer delays.
+     * @param turnaroundLatency Delay between receiving a request and starting the response.
+     */
+    explicit SimulatorDataLinkInterface(SimulatorWEOM& simulator, uint32_t baudrate = DEFAULT_BAUDRATE,
+                                        const Clock::duration& turnaroundLatency = Clock::duration::zero());
+
+    virtual bool isOpened() const override;
+    virtual void closeConnection() override;
+    virtual size_t getMaxDataSize() const override;
+
+    virtual etl::expected<void, Error> read(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Retrieves the number of response bytes that already arrived.
+     * @return Number of bytes that can be read without waiting.
+     */
+    virtual size_t available() const override;
+
+    /**
+     * @brief Reads the response bytes that already arrived, waits for the first one if there are none.
+     * @param buffer Span of bytes to store the read data.
+     * @param timeout Maximum duration to wait for the first byte.
+     * @return Number of bytes read, or an error.
+     */
+    virtual etl::expected<size_t, Error> readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+
+    virtual void dropPendingData() override;
+    virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+
+    /**
+     * @brief Changes the line speed of following transfers, received bytes not read yet are dropped.
+     * @param baudrate Line speed in bits per second, 0 for no transfer delays.
+     * @return Always succeeds.
+     */
+    virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) override;
+
+    /**
+     * @brief Changes the delay between receiving a request and starting the response.
+     * @param turnaroundLatency The turnaround latency.
+     */
+    void setTurnaroundLatency(const Clock::duration& turnaroundLatency);
+
+    static constexpr uint32_t DEFAULT_BAUDRATE = 115200; ///< Baud rate of the device after power-on
+    static constexpr uint32_t BITS_PER_BYTE = 10;        ///< Start bit, 8 data bits and stop bit
+
+private:
+    struct ReceivedByte
+    {
+        uint8_t value;
+        Clock::time_point arrivalTime;
+    };
+
+    Clock::duration getByteDuration() const;
+
+    SimulatorWEOM& m_simulator;
+    uint32_t m_baudrate;
+    Clock::duration m_turnaroundLatency;
+    bool m_opened {true};
+
+    Clock::time_point m_transmitLineFreeTime {};
+    Clock::time_point m_receiveLineFreeTime {};
+    std::deque<ReceivedByte> m_receivedData;
+};
+
+} // namespace wl
+
+#endif // WL_SIMULATORDATALINKINTERFACE_H
@@ -0,0 +1,599 @@
+#include "simulator/simulatorweom.h"
+
+#include "wl/dataclasses/baudrate.h"
+#include "wl/dataclasses/triggers.h"
+
+#include <algorithm>
+#include <string_view>
+
+namespace wl {
+
+namespace {
+
+// settings stored to flash registers and reloaded by resets
+constexpr AddressRange SETTINGS_REGISTERS[] = {
+    MemorySpaceWEOM::GENERAL_REGISTERS, MemorySpaceWEOM::VIDEO_REGISTERS, MemorySpaceWEOM::NUC_REGISTERS,
+    MemorySpaceWEOM::CONNECTION_REGISTERS, MemorySpaceWEOM::FILTERS_REGISTERS, MemorySpaceWEOM::PRESETS_REGISTERS,
+};
+
+constexpr AddressRange READ_ONLY_REGISTERS[] = {
+    MemorySpaceWEOM::DEVICE_IDENTIFICATOR, MemorySpaceWEOM::STATUS,
+    MemorySpaceWEOM::MAIN_FIRMWARE_VERSION, MemorySpaceWEOM::SHUTTER_TEMPERATURE, MemorySpaceWEOM::SERIAL_NUMBER_CURRENT,
+    MemorySpaceWEOM::ARTICLE_NUMBER_CURRENT, MemorySpaceWEOM::SHUTTER_COUNTER, MemorySpaceWEOM::TIME_FROM_LAST_NUC_OFFSET_UPDATE,
+    MemorySpaceWEOM::FRAME_BLOCK_MEDIAN_CONBRIGHT, MemorySpaceWEOM::CURRENT_PRESET_INDEX, MemorySpaceWEOM::ATTRIBUTE_ADDRESS,
+    MemorySpaceWEOM::NUMBER_OF_PRESETS_AND_ATTRIBUTES, MemorySpaceWEOM::CURRENT_PRESET_ID, MemorySpaceWEOM::PALETTES_REGISTERS,
+};
+
+constexpr std::string_view FACTORY_PALETTE_NAMES[] = {
+    "WHITE HOT", "BLACK HOT", "IRON", "RAINBOW", "LAVA", "ARCTIC", "GLOWBOW", "MEDICAL",
+};
+
+constexpr Baudrate::enum_type UART_BAUDRATES[] = {Baudrate::B_115200, Baudrate::B_921600, Baudrate::B_3000000};
+
+bool isValidBaudrate(uint32_t value)
+{
+    return std::find(std::begin(UART_BAUDRATES), std::end(UART_BAUDRATES), value) != std::end(UART_BAUDRATES);
+}
+
+TCSIPacket::Status toResponseStatus(Error error)
+{
+    switch (error)
+    {
+    case Error::TCSI__INVALID_CHECKSUM:
+        return TCSIPacket::Status::WRONG_CHECKSUM;
+    case Error::TCSI__INVALID_SIZE:
+        return TCSIPacket::Status::WRONG_ARGUMENT_COUNT;
+    default:
+        return TCSIPacket::Status::UNKNOWN_COMMAND;
+    }
+}
+
+} // namespace
+
+SimulatorWEOM::SimulatorWEOM() :
+    m_memorySpace(MemorySpaceWEOM::getDeviceSpace())
+{
+    reset();
+}
+
+void SimulatorWEOM::reset()
+{
+    m_memory.clear();
+    m_presets = {
+        PresetId(Range::R1, Lens::WTC_14, PresetVersion::ONUC, LensVariant::A),
+        PresetId(Range::R2, Lens::WTC_14, PresetVersion::ONUC, LensVariant::A),
+        PresetId(Range::HIGH_GAIN, Lens::WTC_14, PresetVersion::ONUC, LensVariant::A),
+    };
+    for (size_t i = 0; i < m_presets.size(); ++i)
+    {
+        writeWord(PRESET_ATTRIBUTES_ADDRESS + i * sizeof(uint32_t), m_presets.at(i).toDeviceValue());
+    }
+
+    loadFactoryDefaults();
+    storeSettingsToFlash();
+    loadSettingsFromFlash();
+
+    m_statusFlags = 0;
+    m_flashBurstAddress.reset();
+    m_flashBurstData.clear();
+    m_busyUntil = {};
+    m_busyResponses = 0;
+    dropPendingData();
+}
+
+void SimulatorWEOM::receive(etl::span<const uint8_t> data)
+{
+    m_receivedBytesCount += data.size();
+    m_requestData.insert(m_requestData.end(), data.begin(), data.end());
+
+    while (true)
+    {
+        const auto synchronization = std::find_if(m_requestData.begin(), m_requestData.end(), TCSIPacket::isSynchronizationValue);
+        m_requestData.erase(m_requestData.begin(), synchronization);
+
+        if (m_requestData.size() < TCSIPacket::HEADER_SIZE)
+        {
+            return;
+        }
+
+        const size_t packetSize = TCSIPacket::MINIMUM_PACKET_SIZE + m_requestData.at(COUNT_POSITION);
+        if (m_requestData.size() < packetSize)
+        {
+            return;
+        }
+
+        const TCSIPacket request(etl::span<uint8_t>(m_requestData.data(), packetSize));
+        m_requestData.erase(m_requestData.begin(), m_requestData.begin() + packetSize);
+
+        const auto response = processRequest(request);
+        m_responseData.insert(m_responseData.end(), response.getPacketData().begin(), response.getPacketData().end());
+        m_transmittedBytesCount += response.getPacketData().size();
+    }
+}
+
+size_t SimulatorWEOM::transmit(etl::span<uint8_t> buffer)
+{
+    const size_t size = std::min(buffer.size(), m_responseData.size());
+    std::copy_n(m_responseData.begin(), size, buffer.begin());
+    m_responseData.erase(m_responseData.begin(), m_responseData.begin() + size);
+    return size;
+}
+
+size_t SimulatorWEOM::getPendingResponseSize() const
+{
+    return m_responseData.size();
+}
+
+void SimulatorWEOM::dropPendingData()
+{
+    m_requestData.clear();
+    m_responseData.clear();
+}
+
+TCSIPacket SimulatorWEOM::processRequest(const TCSIPacket& request)
+{
+    ++m_requestsCount;
+
+    const auto& packetData = request.getPacketData();
+    const uint8_t packetId = packetData.empty() ? 0 : packetData.front() & PACKET_ID_MASK;
+    const uint32_t address = packetData.size() >= TCSIPacket::HEADER_SIZE ? request.getAddress() : 0;
+
+    if (const auto result = request.validateAsRequest(); !result.has_value())
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, toResponseStatus(result.error()));
+    }
+
+    const auto command = static_cast<TCSIPacket::Command>(request.getStatusOrCommand());
+    const auto payloadData = request.getPayloadData();
+
+    const bool statusRead = command == TCSIPacket::Command::READ && payloadData.front() != 0 &&
+                            MemorySpaceWEOM::STATUS.contains(AddressRange::firstAndSize(address, payloadData.front()));
+    if (m_busyResponses > 0)
+    {
+        --m_busyResponses;
+        return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::CAMERA_NOT_READY);
+    }
+    if (isBusy() && !statusRead)
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::CAMERA_NOT_READY);
+    }
+
+    switch (command)
+    {
+    case TCSIPacket::Command::READ:
+        return processRead(packetId, address, payloadData.front());
+    case TCSIPacket::Command::WRITE:
+        return processWrite(packetId, address, payloadData);
+    case TCSIPacket::Command::FLASH_BURST_START:
+        return processFlashBurstStart(packetId, address);
+    case TCSIPacket::Command::FLASH_BURST_END:
+        return processFlashBurstEnd(packetId, address);
+    }
+    return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::UNKNOWN_COMMAND);
+}
+
+void SimulatorWEOM::setTriggerBusyDuration(const Clock::duration& duration)
+{
+    m_triggerBusyDuration = duration;
+}
+
+void SimulatorWEOM::setBusyResponses(unsigned count)
+{
+    m_busyResponses = count;
+}
+
+bool SimulatorWEOM::isBusy() const
+{
+    return Clock::now() < m_busyUntil;
+}
+
+void SimulatorWEOM::peek(uint32_t address, etl::span<uint8_t> data) const
+{
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        const auto byte = m_memory.find(address + i);
+        data[i] = byte != m_memory.end() ? byte->second : getDefaultValue(address + i);
+    }
+}
+
+void SimulatorWEOM::poke(uint32_t address, etl::span<const uint8_t> data)
+{
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        m_memory[address + i] = data[i];
+    }
+}
+
+uint64_t SimulatorWEOM::getRequestsCount() const
+{
+    return m_requestsCount;
+}
+
+uint64_t SimulatorWEOM::getReceivedBytesCount() const
+{
+    return m_receivedBytesCount;
+}
+
+uint64_t SimulatorWEOM::getTransmittedBytesCount() const
+{
+    return m_transmittedBytesCount;
+}
+
+uint32_t SimulatorWEOM::getUartBaudrate() const
+{
+    return Baudrate::getBitsPerSecond(static_cast<Baudrate::enum_type>(readWord(MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getFirstAddress())));
+}
+
+void SimulatorWEOM::setUartBaudrate(uint32_t baudrate)
+{
+    for (const auto value : UART_BAUDRATES)
+    {
+        if (Baudrate::getBitsPerSecond(value) == baudrate)
+        {
+            writeWord(MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getFirstAddress(), value);
+        }
+    }
+}
+
+void SimulatorWEOM::loadFactoryDefaults()
+{
+    for (const auto& addressRange : SETTINGS_REGISTERS)
+    {
+        for (uint32_t address = addressRange.getFirstAddress(); address < addressRange.getFirstAddress() + addressRange.getSize(); address += sizeof(uint32_t))
+        {
+            writeWord(address, 0);
+        }
+    }
+
+    static constexpr uint8_t IDENTIFICATOR[] = {0x57, 0x06, 0x4D, 0x00};
+    poke(MemorySpaceWEOM::DEVICE_IDENTIFICATOR.getFirstAddress(), IDENTIFICATOR);
+
+    static constexpr uint8_t FIRMWARE_VERSION[] = {0x00, 0x00, 0x00, 0x01}; // 1.0.0
+    poke(MemorySpaceWEOM::MAIN_FIRMWARE_VERSION.getFirstAddress(), FIRMWARE_VERSION);
+
+    const auto writeString = [this](const AddressRange& addressRange, std::string_view text)
+    {
+        std::vector<uint8_t> data(addressRange.getSize(), 0);
+        std::copy_n(text.begin(), std::min(text.size(), data.size()), data.begin());
+        poke(addressRange.getFirstAddress(), data);
+    };
+    writeString(MemorySpaceWEOM::SERIAL_NUMBER_CURRENT, "SIM00001");
+    writeString(MemorySpaceWEOM::ARTICLE_NUMBER_CURRENT, "WEOM-SIMULATOR");
+    for (size_t i = 0; i < std::size(FACTORY_PALETTE_NAMES); ++i)
+    {
+        writeString(MemorySpaceWEOM::getPaletteNameAddressRange(i), FACTORY_PALETTE_NAMES[i]);
+    }
+
+    writeWord(MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getFirstAddress(), Baudrate::B_115200);
+    writeWord(MemorySpaceWEOM::NUMBER_OF_PRESETS_AND_ATTRIBUTES.getFirstAddress(), static_cast<uint32_t>(m_presets.size()) << 16);
+}
+
+void SimulatorWEOM::storeSettingsToFlash()
+{
+    for (const auto& addressRange : SETTINGS_REGISTERS)
+    {
+        for (uint32_t address = addressRange.getFirstAddress(); address < addressRange.getFirstAddress() + addressRange.getSize(); address += sizeof(uint32_t))
+        {
+            writeWord(MemorySpaceWEOM::ADDRESS_FLASH_REGISTERS_START + address, readWord(address));
+        }
+    }
+}
+
+void SimulatorWEOM::loadSettingsFromFlash()
+{
+    for (const auto& addressRange : SETTINGS_REGISTERS)
+    {
+        for (uint32_t address = addressRange.getFirstAddress(); address < addressRange.getFirstAddress() + addressRange.getSize(); address += sizeof(uint32_t))
+        {
+            if (!isReadOnly(AddressRange::firstAndSize(address, sizeof(uint32_t))))
+            {
+                writeWord(address, readWord(MemorySpaceWEOM::ADDRESS_FLASH_REGISTERS_START + address));
+            }
+        }
+    }
+
+    m_presetSelectedById = false;
+    if (selectPreset() != TCSIPacket::Status::OK)
+    {
+        // invalid index in flash, fall back to the first preset
+        writeWord(MemorySpaceWEOM::SELECTED_PRESET_INDEX.getFirstAddress(), 0);
+        (void)selectPreset();
+    }
+}
+
+TCSIPacket SimulatorWEOM::processRead(uint8_t packetId, uint32_t address, uint8_t size)
+{
+    if (size == 0)
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::WRONG_ARGUMENT_COUNT);
+    }
+
+    const auto addressRange = AddressRange::firstAndSize(address, size);
+    if (const auto result = validateAccess(addressRange); !result.has_value())
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, result.error());
+    }
+
+    std::vector<uint8_t> data(size);
+    peek(address, data);
+
+    if (addressRange.overlaps(MemorySpaceWEOM::STATUS))
+    {
+        const uint32_t status = readStatus();
+        for (uint32_t i = 0; i < MemorySpaceWEOM::STATUS.getSize(); ++i)
+        {
+            if (const uint32_t statusAddress = MemorySpaceWEOM::STATUS.getFirstAddress() + i; addressRange.contains(statusAddress))
+            {
+                data.at(statusAddress - address) = static_cast<uint8_t>(status >> (8 * i));
+            }
+        }
+    }
+
+    return TCSIPacket::createOkResponse(packetId, address, data);
+}
+
+TCSIPacket SimulatorWEOM::processWrite(uint8_t packetId, uint32_t address, etl::span<const uint8_t> data)
+{
+    const auto addressRange = AddressRange::firstAndSize(address, data.size());
+    if (const auto result = validateAccess(addressRange); !result.has_value())
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, result.error());
+    }
+
+    if (MemorySpaceWEOM::FLASH_MEMORY.contains(addressRange))
+    {
+        if (!m_flashBurstAddress.has_value())
+        {
+            return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::FLASH_BURST_ERROR);
+        }
+
+        // persisted on the burst end
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            m_flashBurstData[address + i] = data[i];
+        }
+        return TCSIPacket::createOkResponse(packetId, address, {});
+    }
+
+    if (const auto status = writeRegisters(address, data); status != TCSIPacket::Status::OK)
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, status);
+    }
+    return TCSIPacket::createOkResponse(packetId, address, {});
+}
+
+TCSIPacket SimulatorWEOM::processFlashBurstStart(uint8_t packetId, uint32_t address)
+{
+    if (!MemorySpaceWEOM::FLASH_MEMORY.contains(address))
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::WRONG_ADDRESS);
+    }
+
+    if (m_flashBurstAddress.has_value())
+    {
+        // nested burst aborts the opened one
+        m_flashBurstAddress.reset();
+        m_flashBurstData.clear();
+        return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::FLASH_BURST_ERROR);
+    }
+
+    m_flashBurstAddress = address;
+    return TCSIPacket::createOkResponse(packetId, address, {});
+}
+
+TCSIPacket SimulatorWEOM::processFlashBurstEnd(uint8_t packetId, uint32_t address)
+{
+    if (!m_flashBurstAddress.has_value())
+    {
+        return TCSIPacket::createErrorResponse(packetId, address, TCSIPacket::Status::FLASH_BURST_ERROR);
+    }
+
+    for (const auto& [byteAddress, value] : m_flashBurstData)
+    {
+        m_memory[byteAddress] = value;
+    }
+    m_flashBurstAddress.reset();
+    m_flashBurstData.clear();
+    return TCSIPacket::createOkResponse(packetId, address, {});
+}
+
+etl::expected<void, TCSIPacket::Status> SimulatorWEOM::validateAccess(const AddressRange& addressRange) const
+{
+    const auto descriptor = m_memorySpace.getMemoryDescriptor(addressRange);
+    if (!descriptor.has_value())
+    {
+        return etl::unexpected<TCSIPacket::Status>(TCSIPacket::Status::WRONG_ADDRESS);
+    }
+
+    if (addressRange.getFirstAddress() % descriptor.value().minimumDataSize != 0)
+    {
+        return etl::unexpected<TCSIPacket::Status>(TCSIPacket::Status::WRONG_ADDRESS);
+    }
+
+    if (addressRange.getSize() % descriptor.value().minimumDataSize != 0 || addressRange.getSize() > descriptor.value().maximumDataSize)
+    {
+        return etl::unexpected<TCSIPacket::Status>(TCSIPacket::Status::WRONG_ARGUMENT_COUNT);
+    }
+
+    return {};
+}
+
+TCSIPacket::Status SimulatorWEOM::writeRegisters(uint32_t address, etl::span<const uint8_t> data)
+{
+    const auto addressRange = AddressRange::firstAndSize(address, data.size());
+    if (isReadOnly(addressRange))
+    {
+        return TCSIPacket::Status::WRONG_ADDRESS;
+    }
+
+    const uint32_t previousBaudrate = readWord(MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getFirstAddress());
+    poke(address, data);
+
+    for (uint32_t registerAddress = address; registerAddress < address + data.size(); registerAddress += sizeof(uint32_t))
+    {
+        if (registerAddress == MemorySpaceWEOM::TRIGGER.getFirstAddress())
+        {
+            // triggers clear themselves
+            const uint32_t triggers = readWord(registerAddress);
+            writeWord(registerAddress, 0);
+            if (const auto status = activateTriggers(triggers); status != TCSIPacket::Status::OK)
+            {
+                return status;
+            }
+        }
+        else if (registerAddress == MemorySpaceWEOM::SELECTED_ATTRIBUTE_AND_PRESET_INDEX.getFirstAddress())
+        {
+            const uint32_t value = readWord(registerAddress);
+            const uint8_t attribute = value & 0xFF;
+            const uint8_t presetIndex = (value >> 16) & 0xFF;
+            if (attribute != PRESET_ID_ATTRIBUTE || presetIndex >= m_presets.size())
+            {
+                writeWord(MemorySpaceWEOM::ATTRIBUTE_ADDRESS.getFirstAddress(), 0);
+                return TCSIPacket::Status::INCORRECT_VALUE;
+            }
+            writeWord(MemorySpaceWEOM::ATTRIBUTE_ADDRESS.getFirstAddress(), PRESET_ATTRIBUTES_ADDRESS + presetIndex * sizeof(uint32_t));
+        }
+        else if (registerAddress == MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getFirstAddress())
+        {
+            if (!isValidBaudrate(readWord(registerAddress)))
+            {
+                writeWord(registerAddress, previousBaudrate);
+                return TCSIPacket::Status::INCORRECT_VALUE;
+            }
+        }
+        else if (registerAddress == MemorySpaceWEOM::SELECTED_PRESET_INDEX.getFirstAddress())
+        {
+            m_presetSelectedById = false;
+        }
+        else if (registerAddress == MemorySpaceWEOM::SELECTED_PRESET_ID.getFirstAddress())
+        {
+            m_presetSelectedById = true;
+        }
+    }
+
+    return TCSIPacket::Status::OK;
+}
+
+TCSIPacket::Status SimulatorWEOM::activateTriggers(uint32_t triggers)
+{
+    if (triggers == 0)
+    {
+        return TCSIPacket::Status::OK;
+    }
+
+    TCSIPacket::Status status = TCSIPacket::Status::OK;
+    if ((triggers & (Trigger::RESET_FPGA | Trigger::RESET_TO_LOADER)) != 0)
+    {
+        loadSettingsFromFlash();
+        m_statusFlags |= STATUS_NUC_REGISTERS_CHANGED | STATUS_PRESETS_REGISTERS_CHANGED;
+    }
+    if ((triggers & Trigger::RESET_TO_FACTORY_DEFAULT) != 0)
+    {
+        loadFactoryDefaults();
+        storeSettingsToFlash();
+        loadSettingsFromFlash();
+        m_statusFlags |= STATUS_NUC_REGISTERS_CHANGED | STATUS_PRESETS_REGISTERS_CHANGED;
+    }
+    if ((triggers & Trigger::SET_SELECTED_PRESET) != 0)
+    {
+        status = selectPreset();
+    }
+    if ((triggers & Trigger::NUC_OFFSET_UPDATE) != 0)
+    {
+        writeWord(MemorySpaceWEOM::SHUTTER_COUNTER.getFirstAddress(), readWord(MemorySpaceWEOM::SHUTTER_COUNTER.getFirstAddress()) + 1);
+        writeWord(MemorySpaceWEOM::TIME_FROM_LAST_NUC_OFFSET_UPDATE.getFirstAddress(), 0);
+        m_statusFlags |= STATUS_NUC_REGISTERS_CHANGED;
+    }
+
+    setBusy();
+    return status;
+}
+
+TCSIPacket::Status SimulatorWEOM::selectPreset()
+{
+    size_t presetIndex = m_presets.size();
+    if (m_presetSelectedById)
+    {
+        uint8_t selectedId[MemorySpaceWEOM::SELECTED_PRESET_ID.getSize()] = {};
+        peek(MemorySpaceWEOM::SELECTED_PRESET_ID.getFirstAddress(), selectedId);
+        const auto preset = std::find_if(m_presets.begin(), m_presets.end(), [&selectedId](const PresetId& preset)
+        {
+            return static_cast<uint8_t>(preset.getRange()) == selectedId[0] &&
+                   static_cast<uint8_t>(preset.getLens()) == selectedId[2] &&
+                   static_cast<uint8_t>(preset.getLensVariant()) == selectedId[3];
+        });
+        presetIndex = std::distance(m_presets.begin(), preset);
+    }
+    else
+    {
+        presetIndex = readWord(MemorySpaceWEOM::SELECTED_PRESET_INDEX.getFirstAddress()) & 0xFF;
+    }
+
+    if (presetIndex >= m_presets.size())
+    {
+        return TCSIPacket::Status::INVALID_SETTINGS;
+    }
+
+    const auto& preset = m_presets.at(presetIndex);
+    const uint8_t presetId[MemorySpaceWEOM::CURRENT_PRESET_ID.getSize()] = {
+        static_cast<uint8_t>(preset.getRange()), 0, static_cast<uint8_t>(preset.getLens()), static_cast<uint8_t>(preset.getLensVariant())
+    };
+    poke(MemorySpaceWEOM::CURRENT_PRESET_ID.getFirstAddress(), presetId);
+    poke(MemorySpaceWEOM::SELECTED_PRESET_ID.getFirstAddress(), presetId);
+    writeWord(MemorySpaceWEOM::CURRENT_PRESET_INDEX.getFirstAddress(), presetIndex);
+    writeWord(MemorySpaceWEOM::SELECTED_PRESET_INDEX.getFirstAddress(), presetIndex);
+    m_statusFlags |= STATUS_PRESETS_REGISTERS_CHANGED;
+    return TCSIPacket::Status::OK;
+}
+
+uint32_t SimulatorWEOM::readStatus()
+{
+    uint32_t status = m_statusFlags;
+    if (isBusy())
+    {
+        status |= STATUS_CAMERA_NOT_READY | STATUS_ANY_TRIGGER_ACTIVE;
+    }
+
+    // change flags are cleared by reading
+    m_statusFlags = 0;
+    return status;
+}
+
+uint32_t SimulatorWEOM::readWord(uint32_t address) const
+{
+    uint8_t data[sizeof(uint32_t)] = {};
+    peek(address, data);
+    return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+void SimulatorWEOM::writeWord(uint32_t address, uint32_t value)
+{
+    const uint8_t data[sizeof(uint32_t)] = {
+        static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)
+    };
+    poke(address, data);
+}
+
+void SimulatorWEOM::setBusy()
+{
+    if (m_triggerBusyDuration > Clock::duration::zero())
+    {
+        m_busyUntil = Clock::now() + m_triggerBusyDuration;
+    }
+}
+
+bool SimulatorWEOM::isReadOnly(const AddressRange& addressRange)
+{
+    return std::any_of(std::begin(READ_ONLY_REGISTERS), std::end(READ_ONLY_REGISTERS), [&addressRange](const AddressRange& readOnlyRange)
+    {
+        return readOnlyRange.overlaps(addressRange);
+    });
+}
+
+uint8_t SimulatorWEOM::getDefaultValue(uint32_t address)
+{
+    // erased flash
+    return MemorySpaceWEOM::FLASH_MEMORY.contains(address) ? 0xFF : 0x00;
+}
+
+} // namespace wl
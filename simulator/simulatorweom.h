@@ -0,0 +1,204 @@
+#ifndef WL_SIMULATORWEOM_H
+#define WL_SIMULATORWEOM_H
+
+#include "wl/communication/addressrange.h"
+#include "wl/communication/tcsipacket.h"
+#include "wl/dataclasses/presetid.h"
+#include "wl/time.h"
+#include "wl/weom/memoryspaceweom.h"
+
+#include <etl/expected.h>
+#include <etl/span.h>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace wl {
+
+/**
+ * @class SimulatorWEOM
+ * @headerfile simulatorweom.h "simulator/simulatorweom.h"
+ * @brief Model of a WEOM device answering TCSI requests, used to run WEOMlink without a camera.
+ *
+ * @details
+ * The simulator implements the memory space of MemorySpaceWEOM:
+ * - configuration registers with read-only identification and telemetry registers,
+ * - flash memory writable only inside a flash burst, content is persisted on the burst end,
+ * - side effects of triggers (preset selection, NUC offset update, resets reloading settings from flash),
+ * - Status::isCameraNotReady and TCSIPacket::Status::CAMERA_NOT_READY responses while the device is busy.
+ *
+ * Request bytes are fed by receive() in arbitrary chunks, responses are taken by transmit().
+ * The simulator does not time transfers, see SimulatorDataLinkInterface and the pty server for timing. The line speed
+ * selected by UART_BAUDRATE_CURRENT is reported by getUartBaudrate() and applies after the response to the write.
+ */
+class SimulatorWEOM
+{
+public:
+    /**
+     * @brief Constructs a device with default settings and presets.
+     */
+    SimulatorWEOM();
+
+    /**
+     * @brief Restores the power-on state including the factory flash content.
+     */
+    void reset();
+
+    /**
+     * @brief Processes request bytes, responses of complete requests are queued for transmit().
+     *
+     * Bytes preceding a synchronization value are skipped, like the device does on a noisy line.
+     * @param data Received bytes.
+     */
+    void receive(etl::span<const uint8_t> data);
+
+    /**
+     * @brief Takes queued response bytes.
+     * @param buffer Buffer to fill.
+     * @return Number of bytes written to the buffer.
+     */
+    size_t transmit(etl::span<uint8_t> buffer);
+
+    /**
+     * @brief Retrieves the number of queued response bytes.
+     * @return Number of bytes transmit() can return.
+     */
+    size_t getPendingResponseSize() const;
+
+    /**
+     * @brief Drops partially received requests and queued responses.
+     */
+    void dropPendingData();
+
+    /**
+     * @brief Processes a single request packet.
+     * @param request The request packet, it does not have to be valid.
+     * @return The response packet.
+     */
+    [[nodiscard]] TCSIPacket processRequest(const TCSIPacket& request);
+
+    /**
+     * @brief Sets how long the device stays busy after activating a trigger.
+     *
+     * Requests other than reading the status register are answered with TCSIPacket::Status::CAMERA_NOT_READY meanwhile.
+     * @param duration Busy duration, zero (default) keeps the device ready.
+     */
+    void setTriggerBusyDuration(const Clock::duration& duration);
+
+    /**
+     * @brief Answers the following requests with TCSIPacket::Status::CAMERA_NOT_READY.
+     * @param count Number of requests to reject.
+     */
+    void setBusyResponses(unsigned count);
+
+    /**
+     * @brief Checks if the device is busy processing a trigger.
+     * @return True if busy, false otherwise.
+     */
+    bool isBusy() const;
+
+    /**
+     * @brief Retrieves memory content without any side effects.
+     * @param address The first address.
+     * @param data Buffer to fill.
+     */
+    void peek(uint32_t address, etl::span<uint8_t> data) const;
+
+    /**
+     * @brief Changes memory content without any side effects, e.g. to prepare a test scenario.
+     * @param address The first address.
+     * @param data Bytes to store.
+     */
+    void poke(uint32_t address, etl::span<const uint8_t> data);
+
+    /**
+     * @brief Retrieves the number of processed requests.
+     * @return Number of requests including rejected ones.
+     */
+    uint64_t getRequestsCount() const;
+
+    /**
+     * @brief Retrieves the number of received request bytes.
+     * @return Number of bytes passed to receive().
+     */
+    uint64_t getReceivedBytesCount() const;
+
+    /**
+     * @brief Retrieves the number of response bytes sent.
+     * @return Number of bytes queued for transmit().
+     */
+    uint64_t getTransmittedBytesCount() const;
+
+    /**
+     * @brief Retrieves the line speed the device talks at, selected by UART_BAUDRATE_CURRENT.
+     * @return Baud rate in bits per second.
+     */
+    uint32_t getUartBaudrate() const;
+
+    /**
+     * @brief Changes the line speed without any side effects, like a device configured to the baud rate before power-on.
+     * @param baudrate Baud rate in bits per second, values other than `Baudrate` ones are ignored.
+     */
+    void setUartBaudrate(uint32_t baudrate);
+
+    static constexpr uint32_t PRESET_ATTRIBUTES_ADDRESS = MemorySpaceWEOM::FLASH_MEMORY.getFirstAddress() + 0x00900000; ///< Flash address of preset ID attributes
+    static constexpr uint8_t PRESET_ID_ATTRIBUTE = 2; ///< Attribute selector of preset IDs in SELECTED_ATTRIBUTE_AND_PRESET_INDEX
+
+private:
+    void loadFactoryDefaults();
+    void storeSettingsToFlash();
+    void loadSettingsFromFlash();
+
+    [[nodiscard]] TCSIPacket processRead(uint8_t packetId, uint32_t address, uint8_t size);
+    [[nodiscard]] TCSIPacket processWrite(uint8_t packetId, uint32_t address, etl::span<const uint8_t> data);
+    [[nodiscard]] TCSIPacket processFlashBurstStart(uint8_t packetId, uint32_t address);
+    [[nodiscard]] TCSIPacket processFlashBurstEnd(uint8_t packetId, uint32_t address);
+
+    [[nodiscard]] etl::expected<void, TCSIPacket::Status> validateAccess(const AddressRange& addressRange) const;
+    [[nodiscard]] TCSIPacket::Status writeRegisters(uint32_t address, etl::span<const uint8_t> data);
+    [[nodiscard]] TCSIPacket::Status activateTriggers(uint32_t triggers);
+    [[nodiscard]] TCSIPacket::Status selectPreset();
+
+    uint32_t readStatus();
+    uint32_t readWord(uint32_t address) const;
+    void writeWord(uint32_t address, uint32_t value);
+    void setBusy();
+
+    static bool isReadOnly(const AddressRange& addressRange);
+    static uint8_t getDefaultValue(uint32_t address);
+
+    static constexpr uint32_t STATUS_CAMERA_NOT_READY = 1u << 1;
+    static constexpr uint32_t STATUS_ANY_TRIGGER_ACTIVE = 1u << 11;
+    static constexpr uint32_t STATUS_NUC_REGISTERS_CHANGED = 1u << 27;
+    static constexpr uint32_t STATUS_PRESETS_REGISTERS_CHANGED = 1u << 31;
+
+    static constexpr size_t COUNT_POSITION = TCSIPacket::HEADER_SIZE - 1; // count is the last header byte
+    static constexpr uint8_t PACKET_ID_MASK = 0x0F;
+
+    const MemorySpaceWEOM m_memorySpace;
+    std::unordered_map<uint32_t, uint8_t> m_memory;
+    std::vector<PresetId> m_presets;
+    uint32_t m_statusFlags {0};
+    bool m_presetSelectedById {false};
+
+    std::optional<uint32_t> m_flashBurstAddress;
+    std::map<uint32_t, uint8_t> m_flashBurstData;
+
+    Clock::duration m_triggerBusyDuration {Clock::duration::zero()};
+    Clock::time_point m_busyUntil {};
+    unsigned m_busyResponses {0};
+
+    std::vector<uint8_t> m_requestData;
+    std::deque<uint8_t> m_responseData;
+    uint64_t m_requestsCount {0};
+    uint64_t m_receivedBytesCount {0};
+    uint64_t m_transmittedBytesCount {0};
+};
+
+} // namespace wl
+
+#endif // WL_SIMULATORWEOM_H
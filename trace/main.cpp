@@ -0,0 +1,72 @@
+#include "trace/traceformat.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace {
+
+const char* getTypeName(wl::TraceRecord::Type type)
+{
+    switch (type)
+    {
+    case wl::TraceRecord::Type::WRITE:
+        return "write";
+    case wl::TraceRecord::Type::READ:
+        return "read";
+    case wl::TraceRecord::Type::DROP_PENDING_DATA:
+        return "drop";
+    case wl::TraceRecord::Type::CLOSE_CONNECTION:
+        return "close";
+    case wl::TraceRecord::Type::SET_BAUDRATE:
+        return "baud";
+    }
+    return "?";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace file>\n"
+                  << "Prints a trace recorded by wl::TraceRecorderDataLinkInterface, one call per line:\n"
+                  << "start time [us], duration [us], call, size, result and transferred bytes.\n";
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream file(argv[1], std::ios::binary);
+    const auto header = wl::TraceFormat::readHeader(file);
+    if (!header.has_value())
+    {
+        std::cerr << "Not a WEOMlink trace: " << argv[1] << "\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "baudrate " << header.value().baudrate << ", max data size " << header.value().maxDataSize << "\n";
+
+    std::chrono::microseconds previousStartTime {0};
+    size_t recordsCount = 0;
+    while (file.peek() != std::ifstream::traits_type::eof())
+    {
+        const auto record = wl::TraceFormat::readRecord(file, previousStartTime);
+        if (!record.has_value())
+        {
+            std::cerr << "Truncated record after " << recordsCount << " records\n";
+            return EXIT_FAILURE;
+        }
+        previousStartTime = record.value().startTime;
+        ++recordsCount;
+
+        std::cout << std::dec << std::setfill(' ') << std::setw(12) << record.value().startTime.count() << std::setw(8) << record.value().duration.count()
+                  << " " << std::left << std::setw(6) << getTypeName(record.value().type) << std::right << std::setw(4) << record.value().size << " "
+                  << (record.value().result.has_value() ? "OK" : record.value().result.error().c_str());
+        for (const auto byte : record.value().data)
+        {
+            std::cout << " " << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
+        }
+        std::cout << "\n";
+    }
+    return EXIT_SUCCESS;
+}
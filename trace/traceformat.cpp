@@ -0,0 +1,194 @@
+#include "trace/traceformat.h"
+
+#include "wl/misc/statistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <optional>
+
+namespace wl {
+
+namespace {
+
+template <typename T>
+void writeLittleEndian(std::ostream& stream, T value)
+{
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        stream.put(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+template <typename T>
+bool readLittleEndian(std::istream& stream, T& value)
+{
+    value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+    {
+        const auto byte = stream.get();
+        if (byte == std::istream::traits_type::eof())
+        {
+            return false;
+        }
+        value |= static_cast<T>(static_cast<uint8_t>(byte)) << (8 * i);
+    }
+    return true;
+}
+
+struct TraceErrorCode
+{
+    Error::enum_type error;
+    uint8_t code;
+};
+
+// codes written to traces, fixed independently of the order of Error, a new error gets the next unused code
+constexpr TraceErrorCode TRACE_ERROR_CODES[] = {
+    {Error::TCSI__INVALID_SIZE, 0},
+    {Error::TCSI__INVALID_SYNCHRONIZATION_VALUE, 1},
+    {Error::TCSI__INVALID_STATUS_OR_COMMAND, 2},
+    {Error::TCSI__INVALID_CHECKSUM, 3},
+    {Error::TCSI__INVALID_RESPONSE_ADDRESS, 4},
+    {Error::TCSI__RESPONSE_DEVICE_BUSY, 5},
+    {Error::TCSI__RESPONSE_STATUS_ERROR, 6},
+    {Error::DATALINK__NO_CONNECTION, 7},
+    {Error::DATALINK__TIMEOUT, 8},
+    {Error::PROTOCOL__NO_DATALINK, 9},
+    {Error::MEMORYSPACE__INVALID_ADDRESS, 10},
+    {Error::DEVICE__NO_PROTOCOL, 11},
+    {Error::DEVICE__INVALID_DATA_SIZE, 12},
+    {Error::DEVICE__INVALID_ADDRESS, 13},
+    {Error::DEVICE__DISCONNECTED, 14},
+    {Error::DEVICE__BUSY, 15},
+    {Error::DEVICE__INVALID_PIN, 16},
+    {Error::INVALID_DATA, 17},
+    {Error::TCSI__RESPONSE_FLASH_BURST_ERROR, 18},
+    {Error::DATALINK__UNSUPPORTED_BAUDRATE, 19},
+};
+static_assert(std::size(TRACE_ERROR_CODES) == ErrorCounts::ERRORS_COUNT, "every error needs a trace code");
+
+uint8_t toTraceErrorCode(Error error)
+{
+    const auto errorCode = std::find_if(std::begin(TRACE_ERROR_CODES), std::end(TRACE_ERROR_CODES), [error](const TraceErrorCode& errorCode)
+    {
+        return errorCode.error == error;
+    });
+    assert(errorCode != std::end(TRACE_ERROR_CODES));
+    return errorCode->code;
+}
+
+std::optional<Error> fromTraceErrorCode(int code)
+{
+    const auto errorCode = std::find_if(std::begin(TRACE_ERROR_CODES), std::end(TRACE_ERROR_CODES), [code](const TraceErrorCode& errorCode)
+    {
+        return errorCode.code == code;
+    });
+    if (errorCode == std::end(TRACE_ERROR_CODES))
+    {
+        return std::nullopt;
+    }
+    return Error(errorCode->error);
+}
+
+} // namespace
+
+void TraceFormat::writeHeader(std::ostream& stream, const TraceHeader& header)
+{
+    stream.write(MAGIC, sizeof(MAGIC));
+    stream.put(static_cast<char>(VERSION));
+    writeLittleEndian(stream, header.baudrate);
+    writeLittleEndian(stream, header.maxDataSize);
+}
+
+void TraceFormat::writeRecord(std::ostream& stream, const TraceRecord& record, const std::chrono::microseconds& previousStartTime)
+{
+    stream.put(static_cast<char>(record.type));
+    stream.put(static_cast<char>(record.result.has_value() ? RESULT_SUCCESS : toTraceErrorCode(record.result.error())));
+    writeVariableLength(stream, std::max<int64_t>(0, (record.startTime - previousStartTime).count()));
+    writeVariableLength(stream, std::max<int64_t>(0, record.duration.count()));
+    writeVariableLength(stream, record.size);
+    stream.write(reinterpret_cast<const char*>(record.data.data()), record.data.size());
+}
+
+etl::expected<TraceHeader, Error> TraceFormat::readHeader(std::istream& stream)
+{
+    char magic[sizeof(MAGIC)] = {};
+    TraceHeader header;
+    if (!stream.read(magic, sizeof(magic)) || !std::equal(std::begin(magic), std::end(magic), std::begin(MAGIC)) ||
+        stream.get() != VERSION || !readLittleEndian(stream, header.baudrate) || !readLittleEndian(stream, header.maxDataSize))
+    {
+        return etl::unexpected<Error>(Error::INVALID_DATA);
+    }
+    return header;
+}
+
+etl::expected<TraceRecord, Error> TraceFormat::readRecord(std::istream& stream, const std::chrono::microseconds& previousStartTime)
+{
+    const auto type = stream.get();
+    const auto result = stream.get();
+    const auto error = fromTraceErrorCode(result);
+    uint64_t startTimeDelta = 0;
+    uint64_t duration = 0;
+    uint64_t size = 0;
+    if (type == std::istream::traits_type::eof() || result == std::istream::traits_type::eof() ||
+        type > static_cast<uint8_t>(TraceRecord::Type::SET_BAUDRATE) ||
+        (result != RESULT_SUCCESS && !error.has_value()) ||
+        !readVariableLength(stream, startTimeDelta) || !readVariableLength(stream, duration) || !readVariableLength(stream, size) ||
+        size > UINT32_MAX)
+    {
+        return etl::unexpected<Error>(Error::INVALID_DATA);
+    }
+
+    TraceRecord record;
+    record.type = static_cast<TraceRecord::Type>(type);
+    if (result != RESULT_SUCCESS)
+    {
+        record.result = etl::unexpected<Error>(error.value());
+    }
+    record.startTime = previousStartTime + std::chrono::microseconds(startTimeDelta);
+    record.duration = std::chrono::microseconds(duration);
+    record.size = static_cast<uint32_t>(size);
+
+    const bool hasData = record.type == TraceRecord::Type::WRITE || (record.type == TraceRecord::Type::READ && record.result.has_value());
+    if (hasData)
+    {
+        record.data.resize(record.size);
+        if (!stream.read(reinterpret_cast<char*>(record.data.data()), record.data.size()))
+        {
+            return etl::unexpected<Error>(Error::INVALID_DATA);
+        }
+    }
+    return record;
+}
+
+void TraceFormat::writeVariableLength(std::ostream& stream, uint64_t value)
+{
+    do
+    {
+        const uint8_t byte = value & 0x7F;
+        value >>= 7;
+        stream.put(static_cast<char>(value != 0 ? byte | 0x80 : byte));
+    }
+    while (value != 0);
+}
+
+bool TraceFormat::readVariableLength(std::istream& stream, uint64_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        const auto byte = stream.get();
+        if (byte == std::istream::traits_type::eof())
+        {
+            return false;
+        }
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace wl
@@ -0,0 +1,113 @@
+#ifndef WL_TRACEFORMAT_H
+#define WL_TRACEFORMAT_H
+
+#include "wl/error.h"
+#include "wl/time.h"
+
+#include <etl/expected.h>
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace wl {
+
+/**
+ * @struct TraceHeader
+ * @headerfile traceformat.h "trace/traceformat.h"
+ * @brief Properties of the recorded data link, stored at the beginning of a trace.
+ */
+struct TraceHeader
+{
+    uint32_t baudrate {0};    ///< IDataLinkInterface::getBaudrate() of the recorded data link.
+    uint64_t maxDataSize {0}; ///< IDataLinkInterface::getMaxDataSize() of the recorded data link.
+};
+
+/**
+ * @struct TraceRecord
+ * @headerfile traceformat.h "trace/traceformat.h"
+ * @brief Single recorded call of a data link.
+ */
+struct TraceRecord
+{
+    /**
+     * @brief Enumeration of recorded calls.
+     */
+    enum class Type : uint8_t
+    {
+        WRITE,             ///< IDataLinkInterface::write, data are the written bytes
+        READ,              ///< IDataLinkInterface::read, data are the read bytes (none if the read failed)
+        DROP_PENDING_DATA, ///< IDataLinkInterface::dropPendingData
+        CLOSE_CONNECTION,  ///< IDataLinkInterface::closeConnection
+        SET_BAUDRATE,      ///< IDataLinkInterface::setBaudrate, size is the baud rate
+    };
+
+    Type type {Type::WRITE};                 ///< The call.
+    etl::expected<void, Error> result;       ///< Result of the call.
+    std::chrono::microseconds startTime {0}; ///< Start of the call since the start of the recording.
+    std::chrono::microseconds duration {0};  ///< Time the call took.
+    uint32_t size {0};                       ///< Size of the written data or of the read buffer, the baud rate of SET_BAUDRATE.
+    std::vector<uint8_t> data;               ///< Transferred bytes.
+};
+
+/**
+ * @class TraceFormat
+ * @headerfile traceformat.h "trace/traceformat.h"
+ * @brief Compact binary trace of data link calls.
+ *
+ * @details
+ * The trace starts with the magic "WLTR", a format version byte, the baud rate (uint32) and the maximum data size (uint64),
+ * integers are little endian. Each record follows as:
+ * - type (1 byte, TraceRecord::Type)
+ * - result (1 byte, 0xFF for success, otherwise the trace code of the error, fixed independently of the values of Error)
+ * - start time since the start of the previous record in microseconds (LEB128)
+ * - duration in microseconds (LEB128)
+ * - size (LEB128) and the transferred bytes (size bytes for writes and successful reads, none otherwise)
+ */
+class TraceFormat
+{
+public:
+    static constexpr uint8_t VERSION = 2; ///< Format version written to the header, raised whenever the record encoding changes (e.g. a new record type).
+
+    /**
+     * @brief Writes the header of a trace.
+     * @param stream Output stream, opened in binary mode.
+     * @param header The header.
+     */
+    static void writeHeader(std::ostream& stream, const TraceHeader& header);
+
+    /**
+     * @brief Writes a record.
+     * @param stream Output stream, positioned after the header or the previous record.
+     * @param record The record.
+     * @param previousStartTime Start time of the previous record (zero for the first record).
+     */
+    static void writeRecord(std::ostream& stream, const TraceRecord& record, const std::chrono::microseconds& previousStartTime);
+
+    /**
+     * @brief Reads the header of a trace.
+     * @param stream Input stream, opened in binary mode.
+     * @return The header, Error::INVALID_DATA if the stream does not start with a trace header of a known version.
+     */
+    [[nodiscard]] static etl::expected<TraceHeader, Error> readHeader(std::istream& stream);
+
+    /**
+     * @brief Reads a record.
+     * @param stream Input stream, positioned after the header or the previous record.
+     * @param previousStartTime Start time of the previous record (zero for the first record).
+     * @return The record, Error::INVALID_DATA at the end of the stream or if the record is truncated or corrupted.
+     */
+    [[nodiscard]] static etl::expected<TraceRecord, Error> readRecord(std::istream& stream, const std::chrono::microseconds& previousStartTime);
+
+private:
+    static constexpr char MAGIC[] = {'W', 'L', 'T', 'R'};
+    static constexpr uint8_t RESULT_SUCCESS = 0xFF;
+
+    static void writeVariableLength(std::ostream& stream, uint64_t value);
+    static bool readVariableLength(std::istream& stream, uint64_t& value);
+};
+
+} // namespace wl
+
+#endif // WL_TRACEFORMAT_H
@@ -0,0 +1,149 @@
+#include "trace/tracerecorderdatalinkinterface.h"
+
+namespace wl {
+
+TraceRecorderDataLinkInterface::TraceRecorderDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface, const std::string& path) :
+    m_dataLinkInterface(etl::move(dataLinkInterface)),
+    m_file(path, std::ios::binary | std::ios::trunc),
+    m_recordingStartTime(Clock::now())
+{
+    TraceFormat::writeHeader(m_file, TraceHeader {getBaudrate(), getMaxDataSize()});
+    m_file.flush();
+}
+
+bool TraceRecorderDataLinkInterface::isOpened() const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isOpened();
+}
+
+void TraceRecorderDataLinkInterface::closeConnection()
+{
+    const auto startTime = Clock::now();
+    if (m_dataLinkInterface)
+    {
+        m_dataLinkInterface->closeConnection();
+    }
+    record(TraceRecord::Type::CLOSE_CONNECTION, startTime, {}, {}, 0);
+    m_file.flush();
+}
+
+size_t TraceRecorderDataLinkInterface::getMaxDataSize() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getMaxDataSize() : 0;
+}
+
+etl::expected<void, Error> TraceRecorderDataLinkInterface::read(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto startTime = Clock::now();
+    const auto result = m_dataLinkInterface->read(buffer, timeout);
+    record(TraceRecord::Type::READ, startTime, result, result.has_value() ? etl::span<const uint8_t>(buffer) : etl::span<const uint8_t>(), buffer.size());
+    return result;
+}
+
+etl::expected<void, Error> TraceRecorderDataLinkInterface::write(etl::span<const uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto startTime = Clock::now();
+    const auto result = m_dataLinkInterface->write(buffer, timeout);
+    record(TraceRecord::Type::WRITE, startTime, result, buffer, buffer.size());
+    return result;
+}
+
+etl::expected<void, Error> TraceRecorderDataLinkInterface::writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto startTime = Clock::now();
+    const auto result = m_dataLinkInterface->writeGather(buffers, timeout);
+
+    std::vector<uint8_t> data;
+    for (const auto& buffer : buffers)
+    {
+        data.insert(data.end(), buffer.begin(), buffer.end());
+    }
+    record(TraceRecord::Type::WRITE, startTime, result, data, data.size());
+    return result;
+}
+
+void TraceRecorderDataLinkInterface::dropPendingData()
+{
+    const auto startTime = Clock::now();
+    if (m_dataLinkInterface)
+    {
+        m_dataLinkInterface->dropPendingData();
+    }
+    record(TraceRecord::Type::DROP_PENDING_DATA, startTime, {}, {}, 0);
+    m_file.flush();
+}
+
+bool TraceRecorderDataLinkInterface::isConnectionLost() const
+{
+    return !m_dataLinkInterface || m_dataLinkInterface->isConnectionLost();
+}
+
+uint32_t TraceRecorderDataLinkInterface::getBaudrate() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getBaudrate() : 0;
+}
+
+bool TraceRecorderDataLinkInterface::isBaudrateSupported(uint32_t baudrate) const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isBaudrateSupported(baudrate);
+}
+
+etl::expected<void, Error> TraceRecorderDataLinkInterface::setBaudrate(uint32_t baudrate)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto startTime = Clock::now();
+    const auto result = m_dataLinkInterface->setBaudrate(baudrate);
+    record(TraceRecord::Type::SET_BAUDRATE, startTime, result, {}, baudrate);
+    m_file.flush();
+    return result;
+}
+
+bool TraceRecorderDataLinkInterface::isRecording() const
+{
+    return m_file.is_open() && m_file.good();
+}
+
+void TraceRecorderDataLinkInterface::record(TraceRecord::Type type, const Clock::time_point& startTime, const etl::expected<void, Error>& result,
+                                            etl::span<const uint8_t> data, uint32_t size)
+{
+    if (!isRecording())
+    {
+        return;
+    }
+
+    TraceRecord record;
+    record.type = type;
+    record.result = result;
+    record.startTime = std::chrono::duration_cast<std::chrono::microseconds>(startTime - m_recordingStartTime);
+    record.duration = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime);
+    record.size = size;
+    record.data.assign(data.begin(), data.end());
+
+    TraceFormat::writeRecord(m_file, record, m_previousStartTime);
+    m_previousStartTime = record.startTime;
+    if (!result.has_value())
+    {
+        m_file.flush();
+    }
+}
+
+} // namespace wl
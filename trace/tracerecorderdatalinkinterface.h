@@ -0,0 +1,79 @@
+#ifndef WL_TRACERECORDERDATALINKINTERFACE_H
+#define WL_TRACERECORDERDATALINKINTERFACE_H
+
+#include "trace/traceformat.h"
+
+#include "wl/communication/idatalinkinterface.h"
+
+#include <etl/memory.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace wl {
+
+/**
+ * @class TraceRecorderDataLinkInterface
+ * @headerfile tracerecorderdatalinkinterface.h "trace/tracerecorderdatalinkinterface.h"
+ * @brief Data link decorator recording all transfers of another data link into a trace file.
+ *
+ * @details
+ * Every read, write, dropPendingData(), closeConnection() and setBaudrate() is passed to the decorated data link and stored
+ * with its monotonic start time, duration, result and bytes (see TraceFormat). The trace is flushed after each
+ * failed call and on drops, so the interesting part survives if the application is killed afterwards.
+ * Replay the trace with TraceReplayDataLinkInterface.
+ * @code
+ * auto dataLink = etl::unique_ptr<wl::IDataLinkInterface>(new wl::TraceRecorderDataLinkInterface(etl::move(serialDataLink), "session.wltrace"));
+ * auto result = weom.setDataLinkInterface(etl::move(dataLink));
+ * @endcode
+ */
+class TraceRecorderDataLinkInterface : public IDataLinkInterface
+{
+public:
+    /**
+     * @brief Constructs the recorder.
+     * @param dataLinkInterface The recorded data link.
+     * @param path Path of the trace file, an existing file is overwritten.
+     */
+    TraceRecorderDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface, const std::string& path);
+
+    virtual bool isOpened() const override;
+    virtual void closeConnection() override;
+    virtual size_t getMaxDataSize() const override;
+
+    virtual etl::expected<void, Error> read(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Forwards the gathered write and records it as a single write of the concatenated buffers.
+     * @param buffers Spans of bytes to write in order.
+     * @param timeout Maximum duration to wait for all data to be written.
+     * @return Result of the recorded data link.
+     */
+    virtual etl::expected<void, Error> writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout) override;
+
+    virtual void dropPendingData() override;
+    virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+    virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) override;
+
+    /**
+     * @brief Checks if the trace file is being written.
+     * @return False if the file could not be created or a write to it failed.
+     */
+    bool isRecording() const;
+
+private:
+    void record(TraceRecord::Type type, const Clock::time_point& startTime, const etl::expected<void, Error>& result, etl::span<const uint8_t> data, uint32_t size);
+
+    etl::unique_ptr<IDataLinkInterface> m_dataLinkInterface;
+    std::ofstream m_file;
+    Clock::time_point m_recordingStartTime;
+    std::chrono::microseconds m_previousStartTime {0};
+};
+
+} // namespace wl
+
+#endif // WL_TRACERECORDERDATALINKINTERFACE_H
@@ -0,0 +1,208 @@
+#include "trace/tracereplaydatalinkinterface.h"
+
+#include <algorithm>
+#include <fstream>
+#include <thread>
+
+namespace wl {
+
+TraceReplayDataLinkInterface::TraceReplayDataLinkInterface(const std::string& path, double timeScale) :
+    m_timeScale(std::max(0.0, timeScale))
+{
+    std::ifstream file(path, std::ios::binary);
+    const auto header = TraceFormat::readHeader(file);
+    if (!header.has_value())
+    {
+        return;
+    }
+    m_header = header.value();
+    m_baudrate = m_header.baudrate;
+
+    std::chrono::microseconds previousStartTime {0};
+    while (file.peek() != std::ifstream::traits_type::eof())
+    {
+        auto record = TraceFormat::readRecord(file, previousStartTime);
+        if (!record.has_value())
+        {
+            // truncated tail of a trace of a killed application, replay what is complete
+            break;
+        }
+        previousStartTime = record.value().startTime;
+        m_records.push_back(std::move(record.value()));
+    }
+    m_loaded = true;
+}
+
+bool TraceReplayDataLinkInterface::isOpened() const
+{
+    return m_loaded && m_opened;
+}
+
+void TraceReplayDataLinkInterface::closeConnection()
+{
+    if (const auto* record = findNextRecord(TraceRecord::Type::CLOSE_CONNECTION))
+    {
+        ++m_nextRecord;
+        sleep(*record);
+    }
+    m_opened = false;
+}
+
+size_t TraceReplayDataLinkInterface::getMaxDataSize() const
+{
+    return m_header.maxDataSize;
+}
+
+etl::expected<void, Error> TraceReplayDataLinkInterface::read(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    (void)timeout;
+
+    if (!isOpened() || m_diverged)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto* record = findNextRecord(TraceRecord::Type::READ);
+    if (!record || record->size != buffer.size())
+    {
+        m_diverged = true;
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    ++m_nextRecord;
+
+    sleep(*record);
+    std::copy(record->data.begin(), record->data.end(), buffer.begin());
+    return record->result;
+}
+
+etl::expected<void, Error> TraceReplayDataLinkInterface::write(etl::span<const uint8_t> buffer, const Clock::duration& timeout)
+{
+    (void)timeout;
+
+    if (!isOpened() || m_diverged)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto* record = findNextRecord(TraceRecord::Type::WRITE);
+    if (!record || !std::equal(buffer.begin(), buffer.end(), record->data.begin(), record->data.end()))
+    {
+        m_diverged = true;
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    ++m_nextRecord;
+
+    sleep(*record);
+    return record->result;
+}
+
+etl::expected<void, Error> TraceReplayDataLinkInterface::writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout)
+{
+    std::vector<uint8_t> data;
+    for (const auto& buffer : buffers)
+    {
+        data.insert(data.end(), buffer.begin(), buffer.end());
+    }
+    return write(data, timeout);
+}
+
+void TraceReplayDataLinkInterface::dropPendingData()
+{
+    if (const auto* record = findNextRecord(TraceRecord::Type::DROP_PENDING_DATA))
+    {
+        ++m_nextRecord;
+        sleep(*record);
+    }
+}
+
+bool TraceReplayDataLinkInterface::isConnectionLost() const
+{
+    return !m_loaded || m_diverged;
+}
+
+uint32_t TraceReplayDataLinkInterface::getBaudrate() const
+{
+    return m_baudrate;
+}
+
+bool TraceReplayDataLinkInterface::isBaudrateSupported(uint32_t baudrate) const
+{
+    return std::any_of(m_records.begin(), m_records.end(), [baudrate](const TraceRecord& record)
+    {
+        return record.type == TraceRecord::Type::SET_BAUDRATE && record.size == baudrate;
+    });
+}
+
+etl::expected<void, Error> TraceReplayDataLinkInterface::setBaudrate(uint32_t baudrate)
+{
+    if (!isOpened() || m_diverged)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto* record = findNextRecord(TraceRecord::Type::SET_BAUDRATE);
+    if (!record || record->size != baudrate)
+    {
+        m_diverged = true;
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    ++m_nextRecord;
+
+    sleep(*record);
+    if (record->result.has_value())
+    {
+        m_baudrate = baudrate;
+    }
+    return record->result;
+}
+
+bool TraceReplayDataLinkInterface::isLoaded() const
+{
+    return m_loaded;
+}
+
+bool TraceReplayDataLinkInterface::isDiverged() const
+{
+    return m_diverged;
+}
+
+size_t TraceReplayDataLinkInterface::getReplayedRecordsCount() const
+{
+    return m_nextRecord;
+}
+
+size_t TraceReplayDataLinkInterface::getRecordsCount() const
+{
+    return m_records.size();
+}
+
+const TraceRecord* TraceReplayDataLinkInterface::findNextRecord(TraceRecord::Type type)
+{
+    if (m_diverged)
+    {
+        return nullptr;
+    }
+
+    // drops and closes are not part of the device conversation, skip those the replayed session does not make
+    while (m_nextRecord < m_records.size() && m_records.at(m_nextRecord).type != type &&
+           (m_records.at(m_nextRecord).type == TraceRecord::Type::DROP_PENDING_DATA || m_records.at(m_nextRecord).type == TraceRecord::Type::CLOSE_CONNECTION))
+    {
+        ++m_nextRecord;
+    }
+
+    if (m_nextRecord >= m_records.size() || m_records.at(m_nextRecord).type != type)
+    {
+        return nullptr;
+    }
+    return &m_records.at(m_nextRecord);
+}
+
+void TraceReplayDataLinkInterface::sleep(const TraceRecord& record) const
+{
+    if (m_timeScale > 0.0)
+    {
+        std::this_thread::sleep_for(std::chrono::duration_cast<Clock::duration>(record.duration * m_timeScale));
+    }
+}
+
+} // namespace wl
@@ -0,0 +1,103 @@
+#ifndef WL_TRACEREPLAYDATALINKINTERFACE_H
+#define WL_TRACEREPLAYDATALINKINTERFACE_H
+
+#include "trace/traceformat.h"
+
+#include "wl/communication/idatalinkinterface.h"
+
+#include <string>
+#include <vector>
+
+namespace wl {
+
+/**
+ * @class TraceReplayDataLinkInterface
+ * @headerfile tracereplaydatalinkinterface.h "trace/tracereplaydatalinkinterface.h"
+ * @brief Data link serving a session recorded by TraceRecorderDataLinkInterface.
+ *
+ * @details
+ * Calls are matched to the records in the recorded order: a write has to send the recorded bytes, a read has to
+ * request the recorded size and gets the recorded bytes and result. Each call takes the recorded duration multiplied
+ * by the time scale (1 preserves the timing, 0 replays as fast as possible), the timeouts passed by WEOMlink are not applied.
+ *
+ * When a call does not match its record, or the trace ends, the replay stops: isDiverged() turns true and all following
+ * calls fail with Error::DATALINK__NO_CONNECTION. dropPendingData() and closeConnection() records are skipped if the
+ * replayed session does not make the same calls. Baud rates switched to during the recording are supported and
+ * setBaudrate() has to request them in the recorded order, getBaudrate() follows them.
+ * @code
+ * auto replay = new wl::TraceReplayDataLinkInterface("session.wltrace", 0.0);
+ * auto result = weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(replay));
+ * @endcode
+ */
+class TraceReplayDataLinkInterface : public IDataLinkInterface
+{
+public:
+    /**
+     * @brief Loads a trace.
+     * @param path Path of the trace file.
+     * @param timeScale Multiplier of the recorded call durations.
+     */
+    explicit TraceReplayDataLinkInterface(const std::string& path, double timeScale = 1.0);
+
+    virtual bool isOpened() const override;
+    virtual void closeConnection() override;
+    virtual size_t getMaxDataSize() const override;
+
+    virtual etl::expected<void, Error> read(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Matches the concatenated buffers against a single write record, like the recorder stores them.
+     * @param buffers Spans of bytes to write in order.
+     * @param timeout Ignored, the recorded duration is replayed.
+     * @return The recorded result, `DATALINK__NO_CONNECTION` if the replay diverged.
+     */
+    virtual etl::expected<void, Error> writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout) override;
+
+    virtual void dropPendingData() override;
+    virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+    virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) override;
+
+    /**
+     * @brief Checks if the trace was loaded.
+     * @return False if the file could not be read or is not a trace.
+     */
+    bool isLoaded() const;
+
+    /**
+     * @brief Checks if the replayed session left the recorded one.
+     * @return True after a call did not match its record or the trace ended.
+     */
+    bool isDiverged() const;
+
+    /**
+     * @brief Retrieves the number of replayed records.
+     * @return Index of the next record, or of the record that did not match after a divergence (equal to getRecordsCount() if the trace ended).
+     */
+    size_t getReplayedRecordsCount() const;
+
+    /**
+     * @brief Retrieves the number of loaded records.
+     * @return Number of records in the trace.
+     */
+    size_t getRecordsCount() const;
+
+private:
+    [[nodiscard]] const TraceRecord* findNextRecord(TraceRecord::Type type);
+    void sleep(const TraceRecord& record) const;
+
+    TraceHeader m_header;
+    uint32_t m_baudrate {0};
+    std::vector<TraceRecord> m_records;
+    size_t m_nextRecord {0};
+    double m_timeScale;
+    bool m_loaded {false};
+    bool m_diverged {false};
+    bool m_opened {true};
+};
+
+} // namespace wl
+
+#endif // WL_TRACEREPLAYDATALINKINTERFACE_H
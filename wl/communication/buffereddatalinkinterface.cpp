@@ -0,0 +1,175 @@
+#include "wl/communication/buffereddatalinkinterface.h"
+
+#include "wl/misc/elapsedtimer.h"
+
+#include <etl/algorithm.h>
+
+namespace wl {
+
+BufferedDataLinkInterface::BufferedDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface) :
+    m_dataLinkInterface(etl::move(dataLinkInterface))
+{
+}
+
+bool BufferedDataLinkInterface::isOpened() const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isOpened();
+}
+
+void BufferedDataLinkInterface::closeConnection()
+{
+    m_begin = 0;
+    m_size = 0;
+    if (m_dataLinkInterface)
+    {
+        m_dataLinkInterface->closeConnection();
+    }
+}
+
+size_t BufferedDataLinkInterface::getMaxDataSize() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getMaxDataSize() : 0;
+}
+
+etl::expected<void, Error> BufferedDataLinkInterface::read(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const ElapsedTimer timer(timeout);
+    const size_t readSize = take(buffer);
+    if (readSize == buffer.size())
+    {
+        return {};
+    }
+
+    // the buffer is empty now
+    const auto rest = buffer.subspan(readSize);
+    if (rest.size() >= BUFFER_SIZE)
+    {
+        return m_dataLinkInterface->read(rest, timer.getRestOfTimeout());
+    }
+
+    if (const auto fillResult = fill(rest.size(), timer.getRestOfTimeout()); !fillResult.has_value())
+    {
+        return fillResult;
+    }
+    take(rest);
+    return {};
+}
+
+etl::expected<void, Error> BufferedDataLinkInterface::write(etl::span<const uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    return m_dataLinkInterface->write(buffer, timeout);
+}
+
+etl::expected<void, Error> BufferedDataLinkInterface::writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+    return m_dataLinkInterface->writeGather(buffers, timeout);
+}
+
+size_t BufferedDataLinkInterface::available() const
+{
+    return m_size + (m_dataLinkInterface ? m_dataLinkInterface->available() : 0);
+}
+
+etl::expected<size_t, Error> BufferedDataLinkInterface::readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    if (m_size == 0 && !buffer.empty())
+    {
+        m_begin = 0;
+        const auto someResult = m_dataLinkInterface->readSome(etl::span<uint8_t>(m_buffer), timeout);
+        if (!someResult.has_value())
+        {
+            return someResult;
+        }
+        m_size = someResult.value();
+    }
+    return take(buffer);
+}
+
+void BufferedDataLinkInterface::dropPendingData()
+{
+    m_begin = 0;
+    m_size = 0;
+    if (m_dataLinkInterface)
+    {
+        m_dataLinkInterface->dropPendingData();
+    }
+}
+
+bool BufferedDataLinkInterface::isConnectionLost() const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isConnectionLost();
+}
+
+uint32_t BufferedDataLinkInterface::getBaudrate() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getBaudrate() : 0;
+}
+
+bool BufferedDataLinkInterface::isBaudrateSupported(uint32_t baudrate) const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isBaudrateSupported(baudrate);
+}
+
+etl::expected<void, Error> BufferedDataLinkInterface::setBaudrate(uint32_t baudrate)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    // bytes received at the previous speed
+    m_begin = 0;
+    m_size = 0;
+    return m_dataLinkInterface->setBaudrate(baudrate);
+}
+
+etl::expected<void, Error> BufferedDataLinkInterface::fill(size_t minimumSize, const Clock::duration& timeout)
+{
+    m_begin = 0;
+    m_size = 0;
+
+    if (const auto readResult = m_dataLinkInterface->read(etl::span<uint8_t>(m_buffer).first(minimumSize), timeout); !readResult.has_value())
+    {
+        return readResult;
+    }
+    m_size = minimumSize;
+
+    // whatever the driver already has, without waiting
+    if (m_size < m_buffer.size() && m_dataLinkInterface->available() > 0)
+    {
+        if (const auto someResult = m_dataLinkInterface->readSome(etl::span<uint8_t>(m_buffer).subspan(m_size), Clock::duration::zero()); someResult.has_value())
+        {
+            m_size += someResult.value();
+        }
+    }
+    return {};
+}
+
+size_t BufferedDataLinkInterface::take(etl::span<uint8_t> buffer)
+{
+    const size_t size = etl::min(buffer.size(), m_size);
+    etl::copy_n(m_buffer.begin() + m_begin, size, buffer.begin());
+    m_begin += size;
+    m_size -= size;
+    return size;
+}
+
+} // namespace wl
@@ -0,0 +1,82 @@
+#ifndef WL_BUFFEREDDATALINKINTERFACE_H
+#define WL_BUFFEREDDATALINKINTERFACE_H
+
+#include "wl/communication/idatalinkinterface.h"
+#include "wl/communication/tcsipacket.h"
+
+#include <etl/array.h>
+#include <etl/memory.h>
+
+namespace wl {
+
+/**
+ * @class BufferedDataLinkInterface
+ * @headerfile buffereddatalinkinterface.h "wl/communication/buffereddatalinkinterface.h"
+ * @brief Data link decorator reading ahead into a buffer.
+ *
+ * @details
+ * Reads are served from the buffer. When it runs out of bytes, the wrapped data link reads the bytes still missing
+ * and then everything else its driver already has (see IDataLinkInterface::available and IDataLinkInterface::readSome)
+ * without waiting, so following parts of a frame delivered in one chunk (e.g. a USB packet of a serial adapter) or
+ * pipelined responses are then read from the buffer without calling the driver. Reading ahead never waits for more
+ * bytes than requested, so it does not delay any read.
+ *
+ * The buffer is refilled only when empty, so it needs no wrap-around. A wrapped data link reporting no available()
+ * bytes is read exactly like without the decorator.
+ * @code
+ * auto dataLink = etl::unique_ptr<wl::IDataLinkInterface>(new MyDataLinkInterface);
+ * auto result = weom.setDataLinkInterface(etl::unique_ptr<wl::IDataLinkInterface>(new wl::BufferedDataLinkInterface(etl::move(dataLink))));
+ * @endcode
+ */
+class BufferedDataLinkInterface : public IDataLinkInterface
+{
+public:
+    /**
+     * @brief Constructs the decorator.
+     * @param dataLinkInterface The wrapped data link, owned by the decorator.
+     */
+    explicit BufferedDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface);
+
+    virtual bool isOpened() const override;
+    virtual void closeConnection() override;
+    virtual size_t getMaxDataSize() const override;
+
+    virtual etl::expected<void, Error> read(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Retrieves the number of bytes in the buffer and in the wrapped data link.
+     * @return Number of bytes that can be read without waiting.
+     */
+    virtual size_t available() const override;
+
+    /**
+     * @brief Reads the buffered bytes, refills the buffer from the wrapped data link first if it is empty.
+     * @param buffer Span of bytes to store the read data.
+     * @param timeout Maximum duration to wait for the first byte.
+     * @return Number of bytes read, or an error.
+     */
+    virtual etl::expected<size_t, Error> readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+
+    virtual void dropPendingData() override;
+    virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+    virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) override;
+
+    static constexpr size_t BUFFER_SIZE = 2 * TCSIPacket::MAXIMUM_PACKET_SIZE; ///< Read-ahead capacity, two maximum frames
+
+private:
+    [[nodiscard]] etl::expected<void, Error> fill(size_t minimumSize, const Clock::duration& timeout);
+    size_t take(etl::span<uint8_t> buffer);
+
+    etl::unique_ptr<IDataLinkInterface> m_dataLinkInterface;
+    etl::array<uint8_t, BUFFER_SIZE> m_buffer {};
+    size_t m_begin {0};
+    size_t m_size {0};
+};
+
+} // namespace wl
+
+#endif // WL_BUFFEREDDATALINKINTERFACE_H
@@ -4,10 +4,12 @@
 #include "wl/error.h"
 #include "wl/time.h"
 
+#include <etl/algorithm.h>
 #include <etl/span.h>
 #include <etl/expected.h>
 
 #include <chrono>
+#include <cstdint>
 
 
 namespace wl {
@@ -56,6 +58,61 @@ public:
      */
     [[nodiscard]] virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) = 0;
 
+    /**
+     * @brief Writes several buffers as one continuous transfer (gather list), e.g. the header, payload and checksum
+     * of a request, so they do not have to be copied together first.
+     *
+     * The default writes the buffers one by one using write(). Data links able to send a gather list (`writev`) or
+     * filling a transmit buffer of the driver (e.g. DMA) should override it, empty buffers are to be skipped.
+     * @param buffers Spans of bytes to write in order.
+     * @param timeout Maximum duration to wait for all data to be written.
+     * @return An `etl::expected<void, Error>` indicating success or failure.
+     */
+    [[nodiscard]] virtual etl::expected<void, Error> writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout)
+    {
+        const auto deadline = Clock::now() + timeout;
+        for (const auto& buffer : buffers)
+        {
+            if (buffer.empty())
+            {
+                continue;
+            }
+            if (const auto result = write(buffer, deadline - Clock::now()); !result.has_value())
+            {
+                return result;
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Retrieves the number of received bytes that can be read without waiting.
+     *
+     * Implementing it is optional, the default returns 0 (nothing or unknown), which makes callers read only the bytes
+     * they need.
+     * @return Number of bytes already received and not read yet.
+     */
+    virtual size_t available() const { return 0; }
+
+    /**
+     * @brief Reads the bytes already received, up to the buffer size, waiting with the timeout only if there are none.
+     *
+     * The default reads available() bytes (at least one) using read(), data links able to take whatever the driver has
+     * in a single call should override it.
+     * @param buffer Span of bytes to store the read data.
+     * @param timeout Maximum duration to wait for the first byte.
+     * @return Number of bytes read (at least one unless the buffer is empty), or an error.
+     */
+    [[nodiscard]] virtual etl::expected<size_t, Error> readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+    {
+        const size_t size = buffer.empty() ? 0 : etl::clamp<size_t>(available(), 1, buffer.size());
+        if (const auto result = read(buffer.first(size), timeout); !result.has_value())
+        {
+            return etl::unexpected<Error>(result.error());
+        }
+        return size;
+    }
+
     /**
      * @brief Discards any pending data in the data link, clearing the internal buffer.
      */
@@ -66,6 +123,29 @@ public:
      * @return True if the connection is lost, false otherwise.
      */
     virtual bool isConnectionLost() const = 0;
+
+    /**
+     * @brief Retrieves the current line speed, used to estimate how long a transfer takes on the wire.
+     * @return Baud rate in bits per second, 0 if unknown (e.g. not a serial line).
+     */
+    virtual uint32_t getBaudrate() const { return 0; }
+
+    /**
+     * @brief Checks if the line speed can be changed by setBaudrate(), used by `WEOM::upgradeBaudrate` to pick the baud rate.
+     * @param baudrate Baud rate in bits per second.
+     * @return True if the data link can switch to the baud rate, false otherwise (default).
+     */
+    virtual bool isBaudrateSupported(uint32_t baudrate) const { (void)baudrate; return false; }
+
+    /**
+     * @brief Changes the line speed of the host side, after the device was told to switch.
+     *
+     * Data received at the previous speed may be discarded. Implementing it is optional, the default keeps the line
+     * speed and returns `DATALINK__UNSUPPORTED_BAUDRATE`.
+     * @param baudrate Baud rate in bits per second.
+     * @return An `etl::expected<void, Error>` indicating success or failure.
+     */
+    [[nodiscard]] virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) { (void)baudrate; return etl::unexpected<Error>(Error::DATALINK__UNSUPPORTED_BAUDRATE); }
 };
 
 } // namespace wl
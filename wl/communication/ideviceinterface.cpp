@@ -14,5 +14,29 @@ IDeviceInterface::~IDeviceInterface()
 {
 }
 
+etl::expected<void, Error> IDeviceInterface::readMany(etl::span<const ReadRequest> requests)
+{
+    for (const auto& request : requests)
+    {
+        if (const auto result = readData(request.data, request.address); !result.has_value())
+        {
+            return result;
+        }
+    }
+    return {};
+}
+
+etl::expected<void, Error> IDeviceInterface::writeMany(etl::span<const WriteRequest> requests)
+{
+    for (const auto& request : requests)
+    {
+        if (const auto result = writeData(request.data, request.address); !result.has_value())
+        {
+            return result;
+        }
+    }
+    return {};
+}
+
 
 } // namespace wl
@@ -54,6 +54,45 @@ public:
      */
     [[nodiscard]] virtual etl::expected<void, Error> writeData(etl::span<const uint8_t> data, uint32_t address) = 0;
 
+    /**
+     * @struct ReadRequest
+     * @brief Single read of readMany().
+     */
+    struct ReadRequest
+    {
+        etl::span<uint8_t> data; ///< Buffer for the read data, its size is the requested data size.
+        uint32_t address {0};    ///< Address to read from.
+    };
+
+    /**
+     * @struct WriteRequest
+     * @brief Single write of writeMany().
+     */
+    struct WriteRequest
+    {
+        etl::span<const uint8_t> data; ///< Data to write.
+        uint32_t address {0};          ///< Address to write to.
+    };
+
+    /**
+     * @brief Reads several possibly unrelated address ranges.
+     *
+     * The default implementation reads the requests one by one, implementations may combine them into fewer transfers.
+     * @param requests The reads, each buffer is filled with the data of its address.
+     * @return An `etl::expected<void, Error>` indicating success or the first error.
+     */
+    [[nodiscard]] virtual etl::expected<void, Error> readMany(etl::span<const ReadRequest> requests);
+
+    /**
+     * @brief Writes several possibly unrelated address ranges.
+     *
+     * The default implementation writes the requests one by one in the given order, implementations may combine them
+     * into fewer transfers. Requests are not executed after the first failed one.
+     * @param requests The writes.
+     * @return An `etl::expected<void, Error>` indicating success or the first error.
+     */
+    [[nodiscard]] virtual etl::expected<void, Error> writeMany(etl::span<const WriteRequest> requests);
+
     /**
      * @brief Reads data from a specified address range on the device.
      * @tparam addressRange The address range to read from, specified as a template parameter.
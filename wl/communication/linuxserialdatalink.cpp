@@ -0,0 +1,431 @@
+#ifdef __linux__
+
+#include "wl/communication/linuxserialdatalink.h"
+
+#include "wl/misc/elapsedtimer.h"
+
+#include <etl/array.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+
+#include <fcntl.h>
+#include <linux/serial.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace wl {
+
+namespace {
+
+struct Speed
+{
+    uint32_t baudrate;
+    speed_t speed;
+};
+
+constexpr Speed SPEEDS[] = {
+    {50, B50}, {75, B75}, {110, B110}, {134, B134}, {150, B150}, {200, B200}, {300, B300}, {600, B600},
+    {1200, B1200}, {1800, B1800}, {2400, B2400}, {4800, B4800}, {9600, B9600}, {19200, B19200}, {38400, B38400},
+    {57600, B57600}, {115200, B115200}, {230400, B230400},
+#ifdef B460800
+    {460800, B460800},
+#endif
+#ifdef B500000
+    {500000, B500000},
+#endif
+#ifdef B576000
+    {576000, B576000},
+#endif
+#ifdef B921600
+    {921600, B921600},
+#endif
+#ifdef B1000000
+    {1000000, B1000000},
+#endif
+#ifdef B1152000
+    {1152000, B1152000},
+#endif
+#ifdef B1500000
+    {1500000, B1500000},
+#endif
+#ifdef B2000000
+    {2000000, B2000000},
+#endif
+#ifdef B2500000
+    {2500000, B2500000},
+#endif
+#ifdef B3000000
+    {3000000, B3000000},
+#endif
+#ifdef B3500000
+    {3500000, B3500000},
+#endif
+#ifdef B4000000
+    {4000000, B4000000},
+#endif
+};
+
+const Speed* findSpeed(uint32_t baudrate)
+{
+    for (const auto& speed : SPEEDS)
+    {
+        if (speed.baudrate == baudrate)
+        {
+            return &speed;
+        }
+    }
+    return nullptr;
+}
+
+bool isConnectionLostIndicator(int errorNumber)
+{
+    return errorNumber == EIO        // hang-up, e.g. unplugged USB adapter
+            || errorNumber == ENXIO
+            || errorNumber == ENODEV
+            || errorNumber == EBADF;
+}
+
+} // namespace
+
+LinuxSerialDataLink::LinuxSerialDataLink(int fileDescriptor, uint32_t baudrate)
+    : m_fileDescriptor(fileDescriptor)
+    , m_baudrate(baudrate)
+    , m_connectionLost(false)
+{
+}
+
+LinuxSerialDataLink::~LinuxSerialDataLink()
+{
+    closeConnection();
+}
+
+etl::unique_ptr<LinuxSerialDataLink> LinuxSerialDataLink::connect(const char* devicePath, uint32_t baudrate)
+{
+    const auto* speed = findSpeed(baudrate);
+    if (!speed)
+    {
+        return etl::unique_ptr<LinuxSerialDataLink>(nullptr);
+    }
+
+    const int fileDescriptor = ::open(devicePath, O_RDWR | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    if (fileDescriptor < 0)
+    {
+        return etl::unique_ptr<LinuxSerialDataLink>(nullptr);
+    }
+    // closes the port on the failures below
+    auto connection = etl::unique_ptr<LinuxSerialDataLink>(new LinuxSerialDataLink(fileDescriptor, baudrate));
+
+    termios options {};
+    if (::tcgetattr(fileDescriptor, &options) != 0)
+    {
+        return etl::unique_ptr<LinuxSerialDataLink>(nullptr);
+    }
+
+    ::cfmakeraw(&options);
+    options.c_cflag &= ~(CSIZE | PARENB | CSTOPB | CRTSCTS);
+    options.c_cflag |= CS8 | CLOCAL | CREAD;
+    options.c_iflag &= ~(IXON | IXOFF | IXANY);
+    // with O_NONBLOCK reads return what the driver has or EAGAIN (VMIN 0 would return 0 and hide a hang-up),
+    // ppoll wakes up on the first received byte and waits with the rest of the call timeout
+    options.c_cc[VMIN] = 1;
+    options.c_cc[VTIME] = 0;
+    if (::cfsetispeed(&options, speed->speed) != 0 || ::cfsetospeed(&options, speed->speed) != 0 ||
+        ::tcsetattr(fileDescriptor, TCSANOW, &options) != 0)
+    {
+        return etl::unique_ptr<LinuxSerialDataLink>(nullptr);
+    }
+
+    // best effort, not every driver supports serial_struct (e.g. pseudo terminals, CDC ACM)
+    serial_struct serial {};
+    if (::ioctl(fileDescriptor, TIOCGSERIAL, &serial) == 0)
+    {
+        serial.flags |= ASYNC_LOW_LATENCY;
+        ::ioctl(fileDescriptor, TIOCSSERIAL, &serial);
+    }
+
+    ::tcflush(fileDescriptor, TCIOFLUSH);
+    return connection;
+}
+
+bool LinuxSerialDataLink::isOpened() const
+{
+    return m_fileDescriptor >= 0;
+}
+
+void LinuxSerialDataLink::closeConnection()
+{
+    if (m_fileDescriptor >= 0)
+    {
+        ::close(m_fileDescriptor);
+        m_fileDescriptor = -1;
+    }
+}
+
+size_t LinuxSerialDataLink::getMaxDataSize() const
+{
+    return std::numeric_limits<size_t>::max();
+}
+
+etl::expected<void, Error> LinuxSerialDataLink::read(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!isOpened() || m_connectionLost)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const ElapsedTimer timer(timeout);
+    size_t receivedSize = 0;
+    while (receivedSize < buffer.size())
+    {
+        // data already received costs a single syscall, ppoll is used only when the driver has nothing
+        const ssize_t result = ::read(m_fileDescriptor, buffer.data() + receivedSize, buffer.size() - receivedSize);
+        if (result > 0)
+        {
+            receivedSize += static_cast<size_t>(result);
+        }
+        else if (result == 0)
+        {
+            // end of file is returned only after a hang-up
+            m_connectionLost = true;
+            return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (const auto waitResult = waitFor(POLLIN, timer.getRestOfTimeout()); !waitResult.has_value())
+            {
+                return waitResult;
+            }
+        }
+        else if (errno != EINTR)
+        {
+            return etl::unexpected<Error>(handleError(errno));
+        }
+    }
+
+    return {};
+}
+
+etl::expected<void, Error> LinuxSerialDataLink::write(etl::span<const uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!isOpened() || m_connectionLost)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const ElapsedTimer timer(timeout);
+    size_t writtenSize = 0;
+    while (writtenSize < buffer.size())
+    {
+        // done when the driver queued the data, the response timeout covers the transmission
+        const ssize_t result = ::write(m_fileDescriptor, buffer.data() + writtenSize, buffer.size() - writtenSize);
+        if (result >= 0)
+        {
+            writtenSize += static_cast<size_t>(result);
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (const auto waitResult = waitFor(POLLOUT, timer.getRestOfTimeout()); !waitResult.has_value())
+            {
+                return waitResult;
+            }
+        }
+        else if (errno != EINTR)
+        {
+            return etl::unexpected<Error>(handleError(errno));
+        }
+    }
+
+    return {};
+}
+
+etl::expected<void, Error> LinuxSerialDataLink::writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout)
+{
+    if (!isOpened() || m_connectionLost)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const ElapsedTimer timer(timeout);
+    size_t bufferIndex = 0;
+    size_t bufferOffset = 0;
+    while (true)
+    {
+        // rest of the data, continuing behind the bytes written by a partial writev
+        etl::array<iovec, MAXIMUM_GATHER_SIZE> vectors {};
+        size_t vectorsCount = 0;
+        for (size_t i = bufferIndex; i < buffers.size() && vectorsCount < vectors.size(); ++i)
+        {
+            const auto buffer = buffers[i].subspan(i == bufferIndex ? bufferOffset : 0);
+            if (!buffer.empty())
+            {
+                vectors[vectorsCount++] = iovec{const_cast<uint8_t*>(buffer.data()), buffer.size()};
+            }
+        }
+        if (vectorsCount == 0)
+        {
+            return {};
+        }
+
+        const ssize_t result = ::writev(m_fileDescriptor, vectors.data(), static_cast<int>(vectorsCount));
+        if (result >= 0)
+        {
+            size_t writtenSize = static_cast<size_t>(result);
+            while (bufferIndex < buffers.size() && writtenSize >= buffers[bufferIndex].size() - bufferOffset)
+            {
+                writtenSize -= buffers[bufferIndex].size() - bufferOffset;
+                ++bufferIndex;
+                bufferOffset = 0;
+            }
+            bufferOffset += writtenSize;
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (const auto waitResult = waitFor(POLLOUT, timer.getRestOfTimeout()); !waitResult.has_value())
+            {
+                return waitResult;
+            }
+        }
+        else if (errno != EINTR)
+        {
+            return etl::unexpected<Error>(handleError(errno));
+        }
+    }
+}
+
+size_t LinuxSerialDataLink::available() const
+{
+    int size = 0;
+    if (!isOpened() || ::ioctl(m_fileDescriptor, FIONREAD, &size) != 0)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(size);
+}
+
+etl::expected<size_t, Error> LinuxSerialDataLink::readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout)
+{
+    if (!isOpened() || m_connectionLost)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const ElapsedTimer timer(timeout);
+    while (!buffer.empty())
+    {
+        const ssize_t result = ::read(m_fileDescriptor, buffer.data(), buffer.size());
+        if (result > 0)
+        {
+            return static_cast<size_t>(result);
+        }
+        else if (result == 0)
+        {
+            m_connectionLost = true;
+            return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (const auto waitResult = waitFor(POLLIN, timer.getRestOfTimeout()); !waitResult.has_value())
+            {
+                return etl::unexpected<Error>(waitResult.error());
+            }
+        }
+        else if (errno != EINTR)
+        {
+            return etl::unexpected<Error>(handleError(errno));
+        }
+    }
+
+    return 0;
+}
+
+void LinuxSerialDataLink::dropPendingData()
+{
+    if (isOpened())
+    {
+        ::tcflush(m_fileDescriptor, TCIFLUSH);
+    }
+}
+
+bool LinuxSerialDataLink::isConnectionLost() const
+{
+    return m_connectionLost;
+}
+
+uint32_t LinuxSerialDataLink::getBaudrate() const
+{
+    return m_baudrate;
+}
+
+bool LinuxSerialDataLink::isBaudrateSupported(uint32_t baudrate) const
+{
+    return findSpeed(baudrate) != nullptr;
+}
+
+etl::expected<void, Error> LinuxSerialDataLink::setBaudrate(uint32_t baudrate)
+{
+    if (!isOpened() || m_connectionLost)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    const auto* speed = findSpeed(baudrate);
+    termios options {};
+    if (!speed || ::tcgetattr(m_fileDescriptor, &options) != 0 ||
+        ::cfsetispeed(&options, speed->speed) != 0 || ::cfsetospeed(&options, speed->speed) != 0 ||
+        ::tcsetattr(m_fileDescriptor, TCSADRAIN, &options) != 0)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__UNSUPPORTED_BAUDRATE);
+    }
+
+    m_baudrate = baudrate;
+    dropPendingData();
+    return {};
+}
+
+etl::expected<void, Error> LinuxSerialDataLink::waitFor(short events, const Clock::duration& timeout)
+{
+    // rest of an expired timeout is negative, ppoll then only checks the state
+    const auto nanoseconds = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count());
+    const timespec pollTimeout {
+        .tv_sec = static_cast<time_t>(nanoseconds / 1'000'000'000),
+        .tv_nsec = static_cast<long>(nanoseconds % 1'000'000'000),
+    };
+
+    pollfd descriptor {.fd = m_fileDescriptor, .events = events, .revents = 0};
+    const int result = ::ppoll(&descriptor, 1, &pollTimeout, nullptr);
+    if (result == 0)
+    {
+        return etl::unexpected<Error>(Error::DATALINK__TIMEOUT);
+    }
+    else if (result < 0)
+    {
+        // interrupted wait is repeated by the caller with the rest of the timeout
+        return errno == EINTR ? etl::expected<void, Error>() : etl::unexpected<Error>(handleError(errno));
+    }
+    else if ((descriptor.revents & (POLLHUP | POLLERR | POLLNVAL)) != 0)
+    {
+        m_connectionLost = true;
+        return etl::unexpected<Error>(Error::DATALINK__NO_CONNECTION);
+    }
+
+    return {};
+}
+
+Error LinuxSerialDataLink::handleError(int errorNumber)
+{
+    if (isConnectionLostIndicator(errorNumber))
+    {
+        m_connectionLost = true;
+        return Error::DATALINK__NO_CONNECTION;
+    }
+    return Error::DATALINK__TIMEOUT;
+}
+
+} // namespace wl
+
+#endif // __linux__
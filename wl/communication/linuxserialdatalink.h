@@ -0,0 +1,123 @@
+#ifndef WL_LINUXSERIALDATALINK_H
+#define WL_LINUXSERIALDATALINK_H
+
+#ifdef __linux__
+
+#include "wl/communication/idatalinkinterface.h"
+
+#include <etl/memory.h>
+
+namespace wl {
+
+/**
+ * @class LinuxSerialDataLink
+ * @headerfile linuxserialdatalink.h "wl/communication/linuxserialdatalink.h"
+ * @brief Data link over a Linux serial port (e.g. `/dev/ttyUSB0`) using termios and poll directly.
+ *
+ * @details
+ * The port is opened non-blocking in raw mode, 8N1 without flow control. VMIN is 1 and VTIME 0, so `read()` takes
+ * whatever the driver already has without the inter-byte timer, `ppoll()` wakes up on the first received byte and
+ * waits with the remaining timeout. `ASYNC_LOW_LATENCY` is requested from the driver (it shortens the latency timer of USB
+ * adapters like FTDI), drivers which do not support it are used as they are.
+ *
+ * A hang-up or an I/O error of the port (e.g. unplugged USB adapter) marks the connection lost, following
+ * calls return `DATALINK__NO_CONNECTION`.
+ *
+ * Available only on Linux (the source is built only there).
+ * @code
+ * auto dataLink = wl::LinuxSerialDataLink::connect("/dev/ttyUSB0", 115200);
+ * if (!dataLink)
+ * {
+ *     return EXIT_FAILURE;
+ * }
+ * auto result = weom.setDataLinkInterface(etl::move(dataLink));
+ * @endcode
+ */
+class LinuxSerialDataLink : public IDataLinkInterface
+{
+    LinuxSerialDataLink(int fileDescriptor, uint32_t baudrate);
+
+public:
+    ~LinuxSerialDataLink();
+
+    LinuxSerialDataLink(const LinuxSerialDataLink&) = delete;
+    LinuxSerialDataLink& operator=(const LinuxSerialDataLink&) = delete;
+
+    /**
+     * @brief Opens and configures the serial port.
+     * @param devicePath Path to the serial device.
+     * @param baudrate Line speed in bits per second, one of the speeds supported by termios (see isBaudrateSupported).
+     * @return The data link, nullptr if the port cannot be opened or configured.
+     */
+    static etl::unique_ptr<LinuxSerialDataLink> connect(const char* devicePath, uint32_t baudrate);
+
+    virtual bool isOpened() const override;
+    virtual void closeConnection() override;
+    virtual size_t getMaxDataSize() const override;
+
+    virtual etl::expected<void, Error> read(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+    virtual etl::expected<void, Error> write(etl::span<const uint8_t> buffer, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Writes the buffers with `writev()`, without copying them together.
+     * @param buffers Spans of bytes to write in order.
+     * @param timeout Maximum duration to wait for all data to be queued in the driver.
+     * @return An `etl::expected<void, Error>` indicating success or failure.
+     */
+    virtual etl::expected<void, Error> writeGather(etl::span<const etl::span<const uint8_t>> buffers, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Retrieves the number of bytes in the driver input queue (`FIONREAD`).
+     * @return Number of bytes that can be read without waiting.
+     */
+    virtual size_t available() const override;
+
+    /**
+     * @brief Takes everything the driver has with a single `read()`, waits for the first byte only if there is nothing.
+     * @param buffer Span of bytes to store the read data.
+     * @param timeout Maximum duration to wait for the first byte.
+     * @return Number of bytes read, or an error.
+     */
+    virtual etl::expected<size_t, Error> readSome(etl::span<uint8_t> buffer, const Clock::duration& timeout) override;
+
+    /**
+     * @brief Discards received data not read yet (`tcflush(TCIFLUSH)`).
+     *
+     * Bytes queued for sending are kept, so a request is never cut in the middle of the frame.
+     */
+    virtual void dropPendingData() override;
+    virtual bool isConnectionLost() const override;
+    virtual uint32_t getBaudrate() const override;
+
+    /**
+     * @brief Checks if the baud rate has a termios speed constant (B50 up to B4000000 where the platform defines it).
+     * @param baudrate Baud rate in bits per second.
+     * @return True if the speed can be set.
+     */
+    virtual bool isBaudrateSupported(uint32_t baudrate) const override;
+
+    /**
+     * @brief Changes the line speed after the bytes already queued for sending are transmitted at the previous speed.
+     *
+     * Received data not read yet are dropped.
+     * @param baudrate Baud rate in bits per second.
+     * @return An `etl::expected<void, Error>` indicating success or failure.
+     */
+    virtual etl::expected<void, Error> setBaudrate(uint32_t baudrate) override;
+
+private:
+    static constexpr size_t MAXIMUM_GATHER_SIZE = 8; ///< Buffers passed to a single writev()
+
+    int m_fileDescriptor;
+    uint32_t m_baudrate;
+    bool m_connectionLost;
+
+    [[nodiscard]] etl::expected<void, Error> waitFor(short events, const Clock::duration& timeout);
+    [[nodiscard]] Error handleError(int errorNumber);
+};
+
+} // namespace wl
+
+#endif // __linux__
+
+#endif // WL_LINUXSERIALDATALINK_H
@@ -3,12 +3,36 @@
 #include "wl/weom/memoryspaceweom.h"
 #include "wl/communication/idatalinkinterface.h"
 #include "wl/misc/elapsedtimer.h"
+#include "wl/misc/logger.h"
+#include "wl/misc/tracer.h"
 
 #include <algorithm>
 
 
 namespace wl {
 
+#ifdef WL_ENABLE_TRACING
+namespace {
+
+const char* getRequestSpanName(const TCSIRequest& request)
+{
+    switch (request.getCommand())
+    {
+        case TCSIPacket::Command::READ:
+            return "TCSI read request";
+        case TCSIPacket::Command::WRITE:
+            return "TCSI write request";
+        case TCSIPacket::Command::FLASH_BURST_START:
+            return "TCSI flash burst start request";
+        case TCSIPacket::Command::FLASH_BURST_END:
+            return "TCSI flash burst end request";
+    }
+    return "TCSI request";
+}
+
+} // namespace
+#endif
+
 
 ProtocolInterfaceTCSI::ProtocolInterfaceTCSI(SleepFunction sleepFunction)
     : m_sleepFunction(sleepFunction)
@@ -20,6 +44,8 @@ void ProtocolInterfaceTCSI::setDataLinkInterface(etl::unique_ptr<IDataLinkInterf
     etl::lock_guard lock(m_mutex);
 
     m_dataLinkInterface = etl::move(dataLinkInterface);
+    m_responseParser.reset();
+    m_flashBurstAddress.reset();
 
     m_straightNoResponsesCount = 0;
     m_connectionLost = false;
@@ -33,7 +59,7 @@ uint32_t ProtocolInterfaceTCSI::getMaxDataSize() const
     }
 
     const uint32_t maxDatalinkDataSize = m_dataLinkInterface->getMaxDataSize() - TCSIPacket::MINIMUM_PACKET_SIZE;
-    const uint32_t maxTcsiDataSize = std::numeric_limits<uint8_t>::max();
+    const uint32_t maxTcsiDataSize = TCSIPacket::MAXIMUM_PAYLOAD_SIZE;
 
     return std::min(maxDatalinkDataSize, maxTcsiDataSize);
 }
@@ -51,19 +77,66 @@ etl::expected<void, Error> ProtocolInterfaceTCSI::readData(etl::span<uint8_t> da
         return {};
     }
 
-    const auto responsePacket = readDataImpl(data.size(), address, timeout);
-    if (!responsePacket.has_value())
+    return readDataImpl(data, address, timeout);
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::writeData(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    if (data.empty())
     {
-        return etl::unexpected<Error>(responsePacket.error());
+        assert(false && "trying to write nothing? - weird");
+        return {};
     }
 
-    assert(responsePacket.value().getPayloadData().size() == data.size());
-    std::copy(responsePacket.value().getPayloadData().begin(), responsePacket.value().getPayloadData().end(), data.begin());
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
 
-    return {};
+    etl::lock_guard lock(m_mutex);
+
+    if (MemorySpaceWEOM::FLASH_MEMORY.contains(address) && !m_flashBurstAddress.has_value())
+    {
+        const auto beginResult = beginFlashBurstImpl(address, timeout);
+        if (!beginResult.has_value())
+        {
+            if (beginResult.error() == Error::TCSI__RESPONSE_FLASH_BURST_ERROR)
+            {
+                // the device still holds a previous burst, it is ended so that the caller can write again
+                (void)abortFlashBurstImpl(address, timeout);
+            }
+            return beginResult;
+        }
+
+        auto result = writeFlashBurstDataImpl(data, address, timeout);
+        if (result.has_value())
+        {
+            result = endFlashBurstImpl(timeout);
+        }
+        if (m_flashBurstAddress.has_value())
+        {
+            (void)abortFlashBurstImpl(address, timeout);
+        }
+        return result;
+    }
+
+    const auto writeRequest = TCSIRequest::createWriteRequest(++m_lastPacketId, address, data);
+    return writeDataImpl(writeRequest, address, timeout);
 }
 
-etl::expected<void, Error> ProtocolInterfaceTCSI::writeData(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout)
+etl::expected<void, Error> ProtocolInterfaceTCSI::beginFlashBurst(uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    etl::lock_guard lock(m_mutex);
+
+    return beginFlashBurstImpl(address, timeout);
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::writeFlashBurstData(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout)
 {
     if (data.empty())
     {
@@ -78,25 +151,226 @@ etl::expected<void, Error> ProtocolInterfaceTCSI::writeData(const etl::span<cons
 
     etl::lock_guard lock(m_mutex);
 
-    if (MemorySpaceWEOM::FLASH_MEMORY.contains(address))
+    return writeFlashBurstDataImpl(data, address, timeout);
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::endFlashBurst(const std::chrono::steady_clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    etl::lock_guard lock(m_mutex);
+
+    return endFlashBurstImpl(timeout);
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::abortFlashBurst(uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
     {
-        auto burstStartRequest = TCSIPacket::createBurstStartRequest(++m_lastPacketId, address);
-        if (auto result =  writeDataImpl(burstStartRequest, address, timeout); !result.has_value())
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    etl::lock_guard lock(m_mutex);
+
+    return abortFlashBurstImpl(address, timeout);
+}
+
+bool ProtocolInterfaceTCSI::isFlashBurstOpened() const
+{
+    etl::lock_guard lock(m_mutex);
+
+    return m_flashBurstAddress.has_value();
+}
+
+void ProtocolInterfaceTCSI::setTracer(Tracer* tracer)
+{
+#ifdef WL_ENABLE_TRACING
+    etl::lock_guard lock(m_mutex);
+
+    m_tracer = tracer;
+#else
+    (void)tracer;
+#endif
+}
+
+void ProtocolInterfaceTCSI::setPipelineDepth(uint8_t depth)
+{
+    etl::lock_guard lock(m_mutex);
+
+    m_pipelineDepth = std::clamp<uint8_t>(depth, 1, MAX_PIPELINE_DEPTH);
+}
+
+uint8_t ProtocolInterfaceTCSI::getPipelineDepth() const
+{
+    etl::lock_guard lock(m_mutex);
+
+    return m_pipelineDepth;
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::readDataPipelined(etl::span<ReadTransfer> transfers, const std::chrono::steady_clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    etl::lock_guard lock(m_mutex);
+
+    for (size_t windowStart = 0; windowStart < transfers.size(); )
+    {
+        const auto window = transfers.subspan(windowStart, std::min<size_t>(m_pipelineDepth, transfers.size() - windowStart));
+
+        PendingRequests pendingRequests;
+        for (size_t i = 0; i < window.size(); ++i)
+        {
+            assert(!window[i].data.empty() && window[i].data.size() <= TCSIPacket::MAXIMUM_PAYLOAD_SIZE);
+
+            const auto readRequest = TCSIRequest::createReadRequest(++m_lastPacketId, window[i].address, window[i].data.size());
+            if (const auto result = sendPipelinedRequest(readRequest, window[i].address, window[i].data, window[i].result, pendingRequests, timeout); !result.has_value())
+            {
+                for (auto& notSentTransfer : window.subspan(i))
+                {
+                    notSentTransfer.result = etl::unexpected<Error>(result.error());
+                }
+                break;
+            }
+        }
+
+        receivePipelinedResponses(pendingRequests, timeout);
+        windowStart += window.size();
+    }
+
+    return {};
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::writeDataPipelined(etl::span<WriteTransfer> transfers, const std::chrono::steady_clock::duration& timeout)
+{
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    etl::lock_guard lock(m_mutex);
+
+    for (size_t windowStart = 0; windowStart < transfers.size(); )
+    {
+        if (MemorySpaceWEOM::FLASH_MEMORY.contains(transfers[windowStart].address))
+        {
+            // the device writes a burst sequentially from its start address, so a gap needs a new burst
+            size_t flashTransfersCount = 1;
+            while (windowStart + flashTransfersCount < transfers.size() &&
+                   MemorySpaceWEOM::FLASH_MEMORY.contains(transfers[windowStart + flashTransfersCount].address) &&
+                   transfers[windowStart + flashTransfersCount].address ==
+                       transfers[windowStart + flashTransfersCount - 1].address + transfers[windowStart + flashTransfersCount - 1].data.size())
+            {
+                ++flashTransfersCount;
+            }
+            writeFlashBurst(transfers.subspan(windowStart, flashTransfersCount), timeout);
+            windowStart += flashTransfersCount;
+            continue;
+        }
+
+        size_t windowSize = 0;
+        while (windowSize < m_pipelineDepth && windowStart + windowSize < transfers.size() &&
+               !MemorySpaceWEOM::FLASH_MEMORY.contains(transfers[windowStart + windowSize].address))
         {
-            return etl::unexpected<Error>(result.error());
+            ++windowSize;
         }
+        const auto window = transfers.subspan(windowStart, windowSize);
 
-        auto writeRequest = TCSIPacket::createWriteRequest(++m_lastPacketId, address, data);
-        if (auto result =  writeDataImpl(writeRequest, address, timeout); !result.has_value())
+        PendingRequests pendingRequests;
+        for (size_t i = 0; i < window.size(); ++i)
         {
-            return etl::unexpected<Error>(result.error());
+            assert(!window[i].data.empty() && window[i].data.size() <= TCSIPacket::MAXIMUM_PAYLOAD_SIZE);
+
+            const auto writeRequest = TCSIRequest::createWriteRequest(++m_lastPacketId, window[i].address, window[i].data);
+            if (const auto result = sendPipelinedRequest(writeRequest, window[i].address, etl::span<uint8_t>(), window[i].result, pendingRequests, timeout); !result.has_value())
+            {
+                for (auto& notSentTransfer : window.subspan(i))
+                {
+                    notSentTransfer.result = etl::unexpected<Error>(result.error());
+                }
+                break;
+            }
         }
-        auto burstEndRequest = TCSIPacket::createBurstEndRequest(++m_lastPacketId, address);
-        return writeDataImpl(burstEndRequest, address, timeout);
+
+        receivePipelinedResponses(pendingRequests, timeout);
+        windowStart += window.size();
     }
 
-    auto writeRequest = TCSIPacket::createWriteRequest(++m_lastPacketId, address, data);
-    return writeDataImpl(writeRequest, address, timeout);
+    return {};
+}
+
+void ProtocolInterfaceTCSI::writeFlashBurst(etl::span<WriteTransfer> transfers, const std::chrono::steady_clock::duration& timeout)
+{
+    // the device writes a burst sequentially, so the burst stops at the first failed transfer and the caller writes again from there
+    const bool ownBurst = !m_flashBurstAddress.has_value();
+    const uint32_t burstAddress = transfers.front().address;
+    auto result = ownBurst ? beginFlashBurstImpl(burstAddress, timeout) : etl::expected<void, Error>();
+    const bool burstBegun = result.has_value();
+    const bool staleBurst = !burstBegun && result.error() == Error::TCSI__RESPONSE_FLASH_BURST_ERROR;
+    size_t writtenCount = 0;
+    while (result.has_value() && writtenCount < transfers.size())
+    {
+        const auto& transfer = transfers[writtenCount];
+        assert(!transfer.data.empty() && transfer.data.size() <= TCSIPacket::MAXIMUM_PAYLOAD_SIZE);
+
+        result = writeFlashBurstDataImpl(transfer.data, transfer.address, timeout);
+        if (result.has_value())
+        {
+            ++writtenCount;
+        }
+    }
+
+    if (ownBurst)
+    {
+        if (!burstBegun)
+        {
+            if (staleBurst)
+            {
+                // the device still holds a previous burst, it is ended so that the caller can write again
+                (void)abortFlashBurstImpl(burstAddress, timeout);
+            }
+        }
+        else if (result.has_value())
+        {
+            result = endFlashBurstImpl(timeout);
+        }
+        else if (m_flashBurstAddress.has_value())
+        {
+            // the end persists the transfers written before the failed one, the failed one may have reached the device
+            // and is written again
+            if (const auto abortResult = abortFlashBurstImpl(burstAddress, timeout); !abortResult.has_value())
+            {
+                writtenCount = 0;
+            }
+        }
+        else
+        {
+            // the device discarded the burst
+            writtenCount = 0;
+        }
+
+        if (m_flashBurstAddress.has_value())
+        {
+            // the end failed without an answer, nothing of the burst is known to be persisted
+            (void)abortFlashBurstImpl(burstAddress, timeout);
+            writtenCount = 0;
+        }
+        else if (!result.has_value() && writtenCount == transfers.size())
+        {
+            // data is not persisted without the burst end
+            writtenCount = 0;
+        }
+    }
+
+    for (size_t i = 0; i < transfers.size(); ++i)
+    {
+        transfers[i].result = i < writtenCount ? etl::expected<void, Error>() : etl::expected<void, Error>(etl::unexpected<Error>(result.error()));
+    }
 }
 
 bool ProtocolInterfaceTCSI::isConnectionLost() const
@@ -104,60 +378,279 @@ bool ProtocolInterfaceTCSI::isConnectionLost() const
     return m_connectionLost;
 }
 
-etl::expected<TCSIPacket, Error> ProtocolInterfaceTCSI::readDataImpl(uint32_t dataSize, uint32_t address, const std::chrono::steady_clock::duration& timeout)
+uint32_t ProtocolInterfaceTCSI::getBaudrate() const
+{
+    return m_dataLinkInterface ? m_dataLinkInterface->getBaudrate() : 0;
+}
+
+bool ProtocolInterfaceTCSI::isBaudrateSupported(uint32_t baudrate) const
+{
+    return m_dataLinkInterface && m_dataLinkInterface->isBaudrateSupported(baudrate);
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::setBaudrate(uint32_t baudrate)
 {
     etl::lock_guard lock(m_mutex);
 
-    auto readRequest = TCSIPacket::createReadRequest(++m_lastPacketId, address, dataSize);
+    if (!m_dataLinkInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    auto result = m_dataLinkInterface->setBaudrate(baudrate);
+    // bytes in flight during the switch are garbage at either speed, timeouts before it say nothing about the new one
+    dropPendingData();
+    m_straightNoResponsesCount = 0;
+    m_connectionLost = false;
+    return result;
+}
+
+ProtocolInterfaceTCSI::Statistics& ProtocolInterfaceTCSI::Statistics::operator+=(const Statistics& other)
+{
+    requestsCount += other.requestsCount;
+    transmittedBytesCount += other.transmittedBytesCount;
+    receivedBytesCount += other.receivedBytesCount;
+    droppedDataCount += other.droppedDataCount;
+    connectionLostCount += other.connectionLostCount;
+    errors += other.errors;
+    return *this;
+}
+
+ProtocolInterfaceTCSI::Statistics ProtocolInterfaceTCSI::getStatistics() const
+{
+#ifdef WL_ENABLE_STATISTICS
+    etl::lock_guard lock(m_mutex);
+
+    return m_statistics;
+#else
+    return {};
+#endif
+}
+
+void ProtocolInterfaceTCSI::resetStatistics()
+{
+#ifdef WL_ENABLE_STATISTICS
+    etl::lock_guard lock(m_mutex);
+
+    m_statistics = {};
+#endif
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::sendPipelinedRequest(const TCSIRequest& request, uint32_t address, etl::span<uint8_t> responseData, etl::expected<void, Error>& result,
+                                                                       PendingRequests& pendingRequests, const std::chrono::steady_clock::duration& timeout)
+{
+    m_lastPacketId = request.getPacketId();
+
+    const uint32_t dataSize = responseData.empty() ? request.getPayloadData().size() : responseData.size();
+    if (const auto requestResult = sendRequest(request, address, dataSize, timeout); !requestResult.has_value())
+    {
+        return requestResult;
+    }
+
+    pendingRequests.push_back(PendingRequest{m_lastPacketId, address, responseData, &result, false});
+    return {};
+}
+
+void ProtocolInterfaceTCSI::receivePipelinedResponses(PendingRequests& pendingRequests, const std::chrono::steady_clock::duration& timeout)
+{
+    WL_TRACE_SPAN(m_tracer, "TCSI wait for responses");
+
+    const auto finishUnfinished = [this, &pendingRequests](Error error)
+    {
+        for (auto& pendingRequest : pendingRequests)
+        {
+            if (!pendingRequest.finished)
+            {
+                *pendingRequest.result = etl::unexpected<Error>(error);
+                pendingRequest.finished = true;
+                countError(error);
+            }
+        }
+    };
+
+    size_t unfinishedCount = pendingRequests.size();
+    ElapsedTimer timer(timeout);
+    while (unfinishedCount > 0)
+    {
+        const auto responsePacketResult = receiveResponsePacket(timer);
+        if (!responsePacketResult.has_value())
+        {
+            if (responsePacketResult.error() == Error::DATALINK__TIMEOUT && pendingRequests.size() > 1)
+            {
+                // device probably does not queue requests - fall back to one request at a time
+                m_pipelineDepth = 1;
+                WL_LOG(LogLevel::INFO, "Response of a pipelined window lost, pipelining disabled", .error = responsePacketResult.error());
+            }
+            finishUnfinished(responsePacketResult.error());
+            WL_TRACE_SPAN_RESULT(responsePacketResult);
+            return;
+        }
+
+        const auto& responsePacket = responsePacketResult.value();
+        assert(responsePacket.validate().has_value());
+
+        const auto pendingRequest = std::find_if(pendingRequests.begin(), pendingRequests.end(), [&responsePacket](const PendingRequest& request)
+        {
+            return !request.finished && request.packetId == responsePacket.getPacketId();
+        });
+        if (pendingRequest == pendingRequests.end())
+        {
+            // late response of an older request
+            WL_LOG(LogLevel::VERBOSE, "Late response ignored", .packetId = responsePacket.getPacketId());
+            WL_TRACE_INSTANT(m_tracer, "TCSI late response", .packetId = responsePacket.getPacketId());
+            continue;
+        }
+
+        if (const auto okValidationResult = responsePacket.validateAsOkResponse(pendingRequest->address, pendingRequest->responseData.size()); okValidationResult.has_value())
+        {
+            std::copy(responsePacket.getPayloadData().begin(), responsePacket.getPayloadData().end(), pendingRequest->responseData.begin());
+            *pendingRequest->result = {};
+        }
+        else
+        {
+            *pendingRequest->result = etl::unexpected<Error>(okValidationResult.error());
+            countError(okValidationResult.error());
+            WL_LOG(LogLevel::VERBOSE, "Response rejected", .error = okValidationResult.error(), .address = pendingRequest->address, .packetId = pendingRequest->packetId);
+        }
+        WL_TRACE_INSTANT(m_tracer, "TCSI response", .address = pendingRequest->address, .packetId = pendingRequest->packetId,
+                         .error = pendingRequest->result->has_value() ? etl::optional<Error>() : pendingRequest->result->error());
+        pendingRequest->finished = true;
+        --unfinishedCount;
+
+        timer = ElapsedTimer(timeout);
+    }
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::readDataImpl(etl::span<uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    etl::lock_guard lock(m_mutex);
+
+    const auto readRequest = TCSIRequest::createReadRequest(++m_lastPacketId, address, data.size());
     m_lastPacketId = readRequest.getPacketId();
 
     const ElapsedTimer timer(timeout);
-    const auto readRequestResult = m_dataLinkInterface->write(readRequest.getPacketData(), timeout);
-    if (!readRequestResult.has_value())
+    if (const auto readRequestResult = sendRequest(readRequest, address, data.size(), timeout); !readRequestResult.has_value())
     {
-        return etl::unexpected<Error>(readRequestResult.error());
+        return readRequestResult;
     }
 
-    return receiveResponse(m_lastPacketId, address, dataSize, timer.getRestOfTimeout());
+    const auto responseResult = receiveResponse(m_lastPacketId, address, data.size(), timer.getRestOfTimeout());
+    if (!responseResult.has_value())
+    {
+        countError(responseResult.error());
+        return etl::unexpected<Error>(responseResult.error());
+    }
+
+    // the view points into the parser's buffer, the payload has to be copied before the lock is released
+    const auto payloadData = responseResult.value().getPayloadData();
+    assert(payloadData.size() == data.size());
+    std::copy(payloadData.begin(), payloadData.end(), data.begin());
+    return {};
 }
 
-etl::expected<void, Error> ProtocolInterfaceTCSI::writeDataImpl(TCSIPacket& writeRequest, uint32_t address, const std::chrono::steady_clock::duration& timeout)
+etl::expected<void, Error> ProtocolInterfaceTCSI::writeDataImpl(const TCSIRequest& writeRequest, uint32_t address, const std::chrono::steady_clock::duration& timeout)
 {
     m_lastPacketId = writeRequest.getPacketId();
 
     const ElapsedTimer timer(timeout);
-    const auto writeRequestResult = m_dataLinkInterface->write(writeRequest.getPacketData(), timeout);
-    if (!writeRequestResult.has_value())
+    if (const auto writeRequestResult = sendRequest(writeRequest, address, writeRequest.getPayloadData().size(), timeout); !writeRequestResult.has_value())
     {
-        return etl::unexpected<Error>(writeRequestResult.error());
+        return writeRequestResult;
     }
 
     auto responseResult = receiveResponse(m_lastPacketId, address, 0, timer.getRestOfTimeout());
     if (!responseResult.has_value())
     {
+        countError(responseResult.error());
         return etl::unexpected<Error>(responseResult.error());
     }
     return {};
 }
 
-etl::expected<TCSIPacket, Error> ProtocolInterfaceTCSI::receiveResponse(uint8_t packetId, uint32_t address, uint32_t dataSize, const std::chrono::steady_clock::duration& timeout)
+etl::expected<void, Error> ProtocolInterfaceTCSI::beginFlashBurstImpl(uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    const auto burstStartRequest = TCSIRequest::createBurstStartRequest(++m_lastPacketId, address);
+    const auto result = writeDataImpl(burstStartRequest, address, timeout);
+    if (result.has_value())
+    {
+        m_flashBurstAddress = address;
+    }
+    return result;
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::writeFlashBurstDataImpl(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    assert(MemorySpaceWEOM::FLASH_MEMORY.contains(address));
+    assert(m_flashBurstAddress.has_value() && "flash burst not opened");
+
+    const auto writeRequest = TCSIRequest::createWriteRequest(++m_lastPacketId, address, data);
+    const auto result = writeDataImpl(writeRequest, address, timeout);
+    if (!result.has_value() && result.error() == Error::TCSI__RESPONSE_FLASH_BURST_ERROR)
+    {
+        // device has aborted the burst
+        m_flashBurstAddress.reset();
+    }
+    return result;
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::endFlashBurstImpl(const std::chrono::steady_clock::duration& timeout)
+{
+    if (!m_flashBurstAddress.has_value())
+    {
+        assert(false && "flash burst not opened");
+        return etl::unexpected<Error>(Error::TCSI__RESPONSE_FLASH_BURST_ERROR);
+    }
+
+    const uint32_t address = m_flashBurstAddress.value();
+    const auto burstEndRequest = TCSIRequest::createBurstEndRequest(++m_lastPacketId, address);
+    const auto result = writeDataImpl(burstEndRequest, address, timeout);
+    if (result.has_value() || result.error() == Error::TCSI__RESPONSE_FLASH_BURST_ERROR)
+    {
+        m_flashBurstAddress.reset();
+    }
+    return result;
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::abortFlashBurstImpl(uint32_t address, const std::chrono::steady_clock::duration& timeout)
+{
+    // the device may hold a burst this side does not know about (e.g. its start response was lost), no open session is required
+    m_flashBurstAddress.reset();
+    const auto burstEndRequest = TCSIRequest::createBurstEndRequest(++m_lastPacketId, address);
+    return writeDataImpl(burstEndRequest, address, timeout);
+}
+
+etl::expected<void, Error> ProtocolInterfaceTCSI::sendRequest(const TCSIRequest& request, [[maybe_unused]] uint32_t address, [[maybe_unused]] uint32_t dataSize,
+                                                              const std::chrono::steady_clock::duration& timeout)
+{
+    WL_TRACE_SPAN(m_tracer, getRequestSpanName(request), .address = address, .size = dataSize, .packetId = request.getPacketId());
+
+    // header, caller's payload and checksum go to the data link without being copied together
+    const auto parts = request.getParts();
+    const auto requestResult = m_dataLinkInterface->writeGather(etl::span<const etl::span<const uint8_t>>(parts.data(), parts.size()), timeout);
+    if (!requestResult.has_value())
+    {
+        WL_TRACE_SPAN_RESULT(requestResult);
+        countError(requestResult.error());
+        return etl::unexpected<Error>(requestResult.error());
+    }
+    countRequest(request);
+    return {};
+}
+
+etl::expected<TCSIPacketView, Error> ProtocolInterfaceTCSI::receiveResponse(uint8_t packetId, uint32_t address, uint32_t dataSize, const std::chrono::steady_clock::duration& timeout)
 {
+    WL_TRACE_SPAN(m_tracer, "TCSI wait for response", .packetId = packetId);
+
     const ElapsedTimer timer(timeout);
     while (true)
     {
         const auto responsePacketResult = receiveResponsePacket(timer);
         if (!responsePacketResult.has_value())
         {
+            WL_TRACE_SPAN_RESULT(responsePacketResult);
             return etl::unexpected<Error>(responsePacketResult.error());
         }
 
-        const auto responseValidationResult = responsePacketResult.value().validateAsResponse(address);
-        if (!responseValidationResult.has_value())
-        {
-            dropPendingData(timer.getRestOfTimeout());
-            return etl::unexpected<Error>(responseValidationResult.error());
-        }
-
         if (responsePacketResult.value().getPacketId() == packetId)
         {
             const auto okValidationResult = responsePacketResult.value().validateAsOkResponse(address, dataSize);
@@ -167,65 +660,100 @@ etl::expected<TCSIPacket, Error> ProtocolInterfaceTCSI::receiveResponse(uint8_t
             }
             else
             {
+                WL_LOG(LogLevel::VERBOSE, "Response rejected", .error = okValidationResult.error(), .address = address, .packetId = packetId);
+                WL_TRACE_SPAN_RESULT(okValidationResult);
                 return etl::unexpected<Error>(okValidationResult.error());
             }
         }
+        WL_LOG(LogLevel::VERBOSE, "Late response ignored", .packetId = responsePacketResult.value().getPacketId());
+        WL_TRACE_INSTANT(m_tracer, "TCSI late response", .packetId = responsePacketResult.value().getPacketId());
     }
 }
 
-etl::expected<TCSIPacket, Error> ProtocolInterfaceTCSI::receiveResponsePacket(const ElapsedTimer& timer)
+etl::expected<TCSIPacketView, Error> ProtocolInterfaceTCSI::receiveResponsePacket(const ElapsedTimer& timer)
 {
-    // try read empty response (ERROR / OK confirmation) or first part of non-empty response
-    etl::vector<uint8_t, TCSIPacket::MAXIMUM_PACKET_SIZE> receivedData(TCSIPacket::MINIMUM_PACKET_SIZE, 0);
-    const auto readResponseResult = m_dataLinkInterface->read(receivedData, timer.getRestOfTimeout());
-    if (!readResponseResult.has_value())
+    // a corrupted frame is reported only if no valid frame follows it in time, the awaited response may still come
+    etl::optional<Error> skippedFrameError;
+    while (true)
     {
-        if (readResponseResult.error() == Error::DATALINK__TIMEOUT)
+        const auto parseResult = m_responseParser.parse();
+        if (!parseResult.has_value())
         {
-            ++m_straightNoResponsesCount;
+            // corrupted frame was skipped, parser continues on the following data
+            skippedFrameError = parseResult.error();
+        }
+        else if (parseResult.value())
+        {
+            // stays in the parser's buffer until the next read
+            const TCSIPacketView responsePacket = m_responseParser.getFrame();
+            m_responseParser.consumeFrame();
+            return responsePacket;
+        }
 
-            if (m_straightNoResponsesCount > MAX_STRAIGHT_NO_RESPONSES_COUNT)
+        // read the rest of the frame being parsed, more only if the data link already has it, so the read never
+        // waits for bytes of a following frame (those are kept by the parser)
+        const auto receiveBuffer = m_responseParser.prepare(etl::max(m_responseParser.getMissingSize(), m_dataLinkInterface->available()));
+        const auto readResult = m_dataLinkInterface->read(receiveBuffer, timer.getRestOfTimeout());
+        if (!readResult.has_value())
+        {
+            if (readResult.error() == Error::DATALINK__TIMEOUT && skippedFrameError.has_value())
             {
-                m_connectionLost = true;
+                // the device responds, the line corrupts its responses
+                dropPendingData();
+                return etl::unexpected<Error>(skippedFrameError.value());
+            }
+            else if (readResult.error() == Error::DATALINK__TIMEOUT)
+            {
+                ++m_straightNoResponsesCount;
+
+                if (m_straightNoResponsesCount > MAX_STRAIGHT_NO_RESPONSES_COUNT)
+                {
+#ifdef WL_ENABLE_STATISTICS
+                    m_statistics.connectionLostCount += m_connectionLost ? 0 : 1;
+#endif
+                    m_connectionLost = true;
+                }
             }
-        }
-
-        dropPendingData(timer.getRestOfTimeout());
-        return etl::unexpected<Error>(readResponseResult.error());
-    }
-    m_straightNoResponsesCount = 0;
-
-    TCSIPacket responsePacket(receivedData);
-    const auto expectedDataSize = responsePacket.getExpectedDataSize();
-    if (!expectedDataSize.has_value())
-    {
-        dropPendingData(timer.getRestOfTimeout());
-        return etl::unexpected<Error>(expectedDataSize.error());
-    }
-    else if (expectedDataSize.value() > 0)
-    {
-        // try read rest of response
-        const auto packetSize = receivedData.size();
-        receivedData.resize(packetSize + expectedDataSize.value(), 0);
 
-        if (const auto readRestOfResponseResult = m_dataLinkInterface->read(etl::span<uint8_t>(receivedData).subspan(packetSize, expectedDataSize.value()), timer.getRestOfTimeout()); !readRestOfResponseResult.has_value())
-        {
-            dropPendingData(timer.getRestOfTimeout());
-            return etl::unexpected<Error>(readRestOfResponseResult.error());
+            dropPendingData();
+            return etl::unexpected<Error>(readResult.error());
         }
-
-        responsePacket = TCSIPacket(receivedData);
+        m_straightNoResponsesCount = 0;
+        m_responseParser.commit(receiveBuffer.size());
+#ifdef WL_ENABLE_STATISTICS
+        m_statistics.receivedBytesCount += receiveBuffer.size();
+#endif
     }
-
-    return responsePacket;
 }
 
-void ProtocolInterfaceTCSI::dropPendingData(const std::chrono::steady_clock::duration& restOfTimeout)
+void ProtocolInterfaceTCSI::dropPendingData()
 {
-    assert(m_sleepFunction);
-    m_sleepFunction(restOfTimeout);
+    WL_TRACE_INSTANT(m_tracer, "TCSI drop pending data");
 
+    m_responseParser.reset();
     m_dataLinkInterface->dropPendingData();
+#ifdef WL_ENABLE_STATISTICS
+    ++m_statistics.droppedDataCount;
+#endif
+}
+
+void ProtocolInterfaceTCSI::countRequest(const TCSIRequest& request)
+{
+#ifdef WL_ENABLE_STATISTICS
+    ++m_statistics.requestsCount;
+    m_statistics.transmittedBytesCount += request.getSize();
+#else
+    (void)request;
+#endif
+}
+
+void ProtocolInterfaceTCSI::countError(Error error)
+{
+#ifdef WL_ENABLE_STATISTICS
+    m_statistics.errors.add(error);
+#else
+    (void)error;
+#endif
 }
 
 } // namespace wl
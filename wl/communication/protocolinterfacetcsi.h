@@ -4,13 +4,21 @@
 #include "wl/communication/idatalinkinterface.h"
 #include "wl/communication/iprotocolinterface.h"
 #include "wl/communication/tcsipacket.h"
+#include "wl/communication/tcsipacketview.h"
+#include "wl/communication/tcsirequest.h"
+#include "wl/communication/tcsiresponseparser.h"
 #include "wl/misc/elapsedtimer.h"
+#include "wl/misc/statistics.h"
+#include "wl/misc/tracer.h"
 #include "wl/error.h"
 #include "wl/time.h"
 
 #include <etl/mutex.h>
 #include <etl/expected.h>
 #include <etl/memory.h>
+#include <etl/optional.h>
+#include <etl/vector.h>
+#include <etl/span.h>
 
 #include <stddef.h>
 
@@ -65,30 +73,240 @@ public:
      */
     [[nodiscard]] virtual etl::expected<void, Error> writeData(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout) override;
 
+    /**
+     * @struct ReadTransfer
+     * @brief Single read of a pipelined batch, see readDataPipelined().
+     */
+    struct ReadTransfer
+    {
+        etl::span<uint8_t> data;           ///< Buffer for the read data, its size is the requested data size.
+        uint32_t address {0};              ///< Address to read from.
+        etl::expected<void, Error> result; ///< Result of this transfer, filled in by readDataPipelined().
+    };
+
+    /**
+     * @struct WriteTransfer
+     * @brief Single write of a pipelined batch, see writeDataPipelined().
+     */
+    struct WriteTransfer
+    {
+        etl::span<const uint8_t> data;     ///< Data to write.
+        uint32_t address {0};              ///< Address to write to.
+        etl::expected<void, Error> result; ///< Result of this transfer, filled in by writeDataPipelined().
+    };
+
+    /**
+     * @brief Sets the tracer receiving spans of the requests and of the waits for responses.
+     *
+     * Has effect only when built with `WL_ENABLE_TRACING`.
+     * @param tracer The tracer, has to outlive this instance, or nullptr to stop tracing.
+     */
+    void setTracer(Tracer* tracer);
+
+    /**
+     * @brief Maximum number of requests in flight.
+     *
+     * Packet ID has only 4 bits - half of the ID space is kept free so a late response of a previous window
+     * can never be mistaken for a response of the current one.
+     */
+    static constexpr uint8_t MAX_PIPELINE_DEPTH = 8;
+
+    /**
+     * @brief Sets the number of requests kept in flight by readDataPipelined() and writeDataPipelined().
+     * @param depth Pipeline depth, clamped to 1 - MAX_PIPELINE_DEPTH. Depth 1 sends one request and waits for its response.
+     */
+    void setPipelineDepth(uint8_t depth);
+
+    /**
+     * @brief Retrieves the current pipeline depth.
+     *
+     * The depth drops to 1 automatically when a response of a pipelined window is lost, since that
+     * suggests the device does not queue requests. Call setPipelineDepth() to enable pipelining again.
+     * @return Number of requests kept in flight.
+     */
+    uint8_t getPipelineDepth() const;
+
+    /**
+     * @brief Reads several independent blocks, keeping up to getPipelineDepth() requests in flight.
+     *
+     * Responses are matched to requests by packet ID. Each transfer gets its own result; the return value
+     * reports only errors that prevent any transfer (e.g. missing data link).
+     * @param transfers Transfers to perform. Each data size must not exceed getMaxDataSize().
+     * @param timeout The maximum duration to wait for each response.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> readDataPipelined(etl::span<ReadTransfer> transfers, const std::chrono::steady_clock::duration& timeout);
+
+    /**
+     * @brief Writes several independent blocks, keeping up to getPipelineDepth() requests in flight.
+     *
+     * Flash memory writes are never pipelined - consecutive flash transfers of contiguous addresses are written sequentially
+     * in a single flash burst, an address gap starts a new burst. A burst stops at its first failed transfer, the following
+     * transfers get the same error; if the burst could not be ended, none of its transfers is reported as written.
+     * @param transfers Transfers to perform. Each data size must not exceed getMaxDataSize().
+     * @param timeout The maximum duration to wait for each response.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> writeDataPipelined(etl::span<WriteTransfer> transfers, const std::chrono::steady_clock::duration& timeout);
+
+    /**
+     * @brief Opens a flash burst session, so that several flash writes share a single burst start/end pair.
+     *
+     * Between beginFlashBurst() and endFlashBurst() flash memory is written using writeFlashBurstData().
+     * If the device rejects a write with Error::TCSI__RESPONSE_FLASH_BURST_ERROR, the session is closed
+     * and has to be opened again before writing the rest of the data.
+     * @param address Flash memory address of the first write.
+     * @param timeout The maximum duration to wait for the response.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> beginFlashBurst(uint32_t address, const std::chrono::steady_clock::duration& timeout);
+
+    /**
+     * @brief Writes data to flash memory within the flash burst opened by beginFlashBurst().
+     * @param data A span of the data to write. Its size must not exceed getMaxDataSize().
+     * @param address Flash memory address to write to.
+     * @param timeout The maximum duration to wait for the response.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> writeFlashBurstData(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout);
+
+    /**
+     * @brief Closes the flash burst opened by beginFlashBurst().
+     * @param timeout The maximum duration to wait for the response.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> endFlashBurst(const std::chrono::steady_clock::duration& timeout);
+
+    /**
+     * @brief Ends a flash burst that may be open on the device, e.g. after a write within it failed or after the device
+     * rejected beginFlashBurst() because its previous burst was not ended.
+     *
+     * Unlike endFlashBurst() it does not require an open session, the session is considered closed whatever the response.
+     * @param address Flash memory address the burst was opened at.
+     * @param timeout The maximum duration to wait for the response.
+     * @return An `etl::expected<void, Error>` indicating success (data written in the burst are persisted) or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> abortFlashBurst(uint32_t address, const std::chrono::steady_clock::duration& timeout);
+
+    /**
+     * @brief Checks if a flash burst session is open.
+     * @return true if beginFlashBurst() succeeded and the burst was not closed since, false otherwise.
+     */
+    bool isFlashBurstOpened() const;
+
     /**
      * @brief Checks if the connection has been lost.
      * @return true if the connection is lost, false otherwise.
      */
     bool isConnectionLost() const;
 
+    /**
+     * @brief Retrieves the baud rate reported by the data link interface.
+     * @return Baud rate in bits per second, 0 if unknown or no data link interface is set.
+     * @see IDataLinkInterface::getBaudrate
+     */
+    uint32_t getBaudrate() const;
+
+    /**
+     * @brief Checks if the data link can switch to a baud rate.
+     * @param baudrate Baud rate in bits per second.
+     * @return True if supported, false otherwise or if no data link interface is set.
+     * @see IDataLinkInterface::isBaudrateSupported
+     */
+    bool isBaudrateSupported(uint32_t baudrate) const;
+
+    /**
+     * @brief Switches the data link to a baud rate and drops data received at the previous one.
+     * @param baudrate Baud rate in bits per second.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     * @see IDataLinkInterface::setBaudrate
+     */
+    [[nodiscard]] etl::expected<void, Error> setBaudrate(uint32_t baudrate);
+
+    /**
+     * @struct Statistics
+     * @brief Counters of the TCSI traffic, collected only when built with `WL_ENABLE_STATISTICS` (see STATISTICS_ENABLED).
+     */
+    struct Statistics
+    {
+        uint32_t requestsCount {0};         ///< Request packets written to the data link.
+        uint64_t transmittedBytesCount {0}; ///< Bytes of the written requests.
+        uint64_t receivedBytesCount {0};    ///< Bytes read from the data link.
+        uint32_t droppedDataCount {0};      ///< Times pending data were dropped after a failed read from the data link.
+        uint32_t connectionLostCount {0};   ///< Times the connection was marked lost (see isConnectionLost()).
+        ErrorCounts errors;                 ///< Failed requests by error.
+
+        /**
+         * @brief Adds counters of another instance.
+         * @param other Counters to add.
+         * @return Reference to this instance.
+         */
+        Statistics& operator+=(const Statistics& other);
+    };
+
+    /**
+     * @brief Retrieves the counters collected since construction or resetStatistics().
+     * @return Copy of the counters, zero unless built with `WL_ENABLE_STATISTICS`.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Sets all counters to zero.
+     */
+    void resetStatistics();
+
 private:
-    [[nodiscard]] etl::expected<TCSIPacket, Error> readDataImpl(uint32_t dataSize, uint32_t address, const std::chrono::steady_clock::duration& timeout);
-    [[nodiscard]] etl::expected<void, Error> writeDataImpl(TCSIPacket& packet, uint32_t address, const std::chrono::steady_clock::duration& timeout);
+    struct PendingRequest
+    {
+        uint8_t packetId {0};
+        uint32_t address {0};
+        etl::span<uint8_t> responseData;
+        etl::expected<void, Error>* result {nullptr};
+        bool finished {false};
+    };
+    using PendingRequests = etl::vector<PendingRequest, MAX_PIPELINE_DEPTH>;
+
+    [[nodiscard]] etl::expected<void, Error> readDataImpl(etl::span<uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout);
+    [[nodiscard]] etl::expected<void, Error> writeDataImpl(const TCSIRequest& request, uint32_t address, const std::chrono::steady_clock::duration& timeout);
 
-    [[nodiscard]] etl::expected<TCSIPacket, Error> receiveResponse(uint8_t packetId, uint32_t address, uint32_t dataSize, const std::chrono::steady_clock::duration& timeout);
-    [[nodiscard]] etl::expected<TCSIPacket, Error> receiveResponsePacket(const ElapsedTimer& timer);
-    void dropPendingData(const std::chrono::steady_clock::duration& restOfTimeout);
+    [[nodiscard]] etl::expected<void, Error> beginFlashBurstImpl(uint32_t address, const std::chrono::steady_clock::duration& timeout);
+    [[nodiscard]] etl::expected<void, Error> writeFlashBurstDataImpl(const etl::span<const uint8_t> data, uint32_t address, const std::chrono::steady_clock::duration& timeout);
+    [[nodiscard]] etl::expected<void, Error> endFlashBurstImpl(const std::chrono::steady_clock::duration& timeout);
+    [[nodiscard]] etl::expected<void, Error> abortFlashBurstImpl(uint32_t address, const std::chrono::steady_clock::duration& timeout);
+
+    [[nodiscard]] etl::expected<void, Error> sendPipelinedRequest(const TCSIRequest& request, uint32_t address, etl::span<uint8_t> responseData, etl::expected<void, Error>& result,
+                                                                  PendingRequests& pendingRequests, const std::chrono::steady_clock::duration& timeout);
+    void receivePipelinedResponses(PendingRequests& pendingRequests, const std::chrono::steady_clock::duration& timeout);
+    void writeFlashBurst(etl::span<WriteTransfer> transfers, const std::chrono::steady_clock::duration& timeout);
+
+    [[nodiscard]] etl::expected<void, Error> sendRequest(const TCSIRequest& request, uint32_t address, uint32_t dataSize, const std::chrono::steady_clock::duration& timeout);
+    [[nodiscard]] etl::expected<TCSIPacketView, Error> receiveResponse(uint8_t packetId, uint32_t address, uint32_t dataSize, const std::chrono::steady_clock::duration& timeout);
+    [[nodiscard]] etl::expected<TCSIPacketView, Error> receiveResponsePacket(const ElapsedTimer& timer);
+    void dropPendingData();
+
+    void countRequest(const TCSIRequest& request);
+    void countError(Error error);
 
     static constexpr size_t MAX_STRAIGHT_NO_RESPONSES_COUNT = 2;
 
     etl::unique_ptr<IDataLinkInterface> m_dataLinkInterface;
+    TCSIResponseParser m_responseParser;
     uint8_t m_lastPacketId {0};
+    uint8_t m_pipelineDepth {1};
+    etl::optional<uint32_t> m_flashBurstAddress;
 
     size_t m_straightNoResponsesCount {0};
     bool m_connectionLost {false};
 
     mutable etl::mutex m_mutex;
     SleepFunction m_sleepFunction;
+
+#ifdef WL_ENABLE_STATISTICS
+    Statistics m_statistics;
+#endif
+#ifdef WL_ENABLE_TRACING
+    Tracer* m_tracer {nullptr};
+#endif
 };
 
 } // namespace wl
@@ -46,6 +46,18 @@ public:
         INCORRECT_VALUE      = 0x08,
     };
 
+    /**
+     * @enum Command
+     * @brief Enumeration for commands in TCSI requests.
+     */
+    enum class Command : uint8_t
+    {
+        READ              = 0x80,
+        WRITE             = 0x81,
+        FLASH_BURST_START = 0x82,
+        FLASH_BURST_END   = 0x83,
+    };
+
     /**
      * @brief Creates a read request packet.
      * @param packetId The ID of the packet.
@@ -131,7 +143,8 @@ public:
      * @retval Error::TCSI__INVALID_CHECKSUM if checksum is incorrect
      * @retval Error::TCSI__INVALID_RESPONSE_ADDRESS if address and packed address do not match
      * @retval Error::TCSI__RESPONSE_DEVICE_BUSY if packet status is Status::CAMERA_NOT_READY
-     * @retval Error::TCSI__RESPONSE_STATUS_ERROR if packet status is not Status::OK or Status::CAMERA_NOT_READY
+     * @retval Error::TCSI__RESPONSE_FLASH_BURST_ERROR if packet status is Status::FLASH_BURST_ERROR
+     * @retval Error::TCSI__RESPONSE_STATUS_ERROR if packet status is not Status::OK, Status::CAMERA_NOT_READY or Status::FLASH_BURST_ERROR
      */
     [[nodiscard]] etl::expected<void, Error> validateAsOkResponse(uint32_t address, uint8_t payloadDataSize) const;
 
@@ -154,12 +167,31 @@ public:
      */
     [[nodiscard]] etl::expected<uint8_t, Error> getExpectedDataSize() const;
 
+    /**
+     * @brief Checks if a byte carries the synchronization value expected in the first byte of each packet.
+     * @param value The first byte of a packet (synchronization value and packet ID).
+     * @return True if the synchronization part matches, false otherwise.
+     */
+    static constexpr bool isSynchronizationValue(uint8_t value);
+
     /**
      * @brief Retrieves the packet ID.
      * @return The packet ID.
      */
     uint8_t getPacketId() const;
 
+    /**
+     * @brief Retrieves the status (responses) or command (requests) byte.
+     * @return The status or command byte, compare with Status or Command values.
+     */
+    uint8_t getStatusOrCommand() const;
+
+    /**
+     * @brief Retrieves the address the packet refers to.
+     * @return The address.
+     */
+    uint32_t getAddress() const;
+
     /**
      * @brief Retrieves the data payload as a span.
      * @return A span of bytes representing the payload data.
@@ -190,19 +222,14 @@ private:
 public:
     static constexpr size_t HEADER_SIZE = DATA_POSITION; /**< 1B sync + 1B status + 4B address + 1B count */
     static constexpr size_t MINIMUM_PACKET_SIZE = HEADER_SIZE + 1; /**< header + 1B checksum + 0B data */
-    static constexpr size_t MAXIMUM_PACKET_SIZE = 255; /**< header + 1B checksum + 0B data */
+    static constexpr size_t MAXIMUM_PAYLOAD_SIZE = 255; /**< limited by 1B count */
+    static constexpr size_t MAXIMUM_PACKET_SIZE = MINIMUM_PACKET_SIZE + MAXIMUM_PAYLOAD_SIZE; /**< header + 1B checksum + 255B data */
 
 private:
-    enum class Command : uint8_t
-    {
-        READ  = 0x80,
-        WRITE = 0x81,
-        FLASH_BURST_START = 0x82,
-        FLASH_BURST_END   = 0x83,
-    };
+    friend class TCSIPacketView;
+    friend class TCSIRequest;
 
-    uint8_t getStatusOrCommand() const;
-    uint32_t getAddress() const;
+    TCSIPacket() = default;
 
     [[nodiscard]] static TCSIPacket createPacket(uint8_t statusOrCommand, uint8_t packetId, uint32_t address, etl::span<const uint8_t> payloadData);
     [[nodiscard]] static uint8_t calculateCheckSum(const etl::span<const uint8_t> packetData);
@@ -214,6 +241,13 @@ private:
     etl::vector<uint8_t, MAXIMUM_PACKET_SIZE> m_packetData;
 };
 
+// Impl
+
+constexpr bool TCSIPacket::isSynchronizationValue(uint8_t value)
+{
+    return (value & SYNCHRONIZATION_MASK) == (SYNCHRONIZATION_VALUE & SYNCHRONIZATION_MASK);
+}
+
 } // namespace wl
 
 #endif // WL_TCSIPACKET_H
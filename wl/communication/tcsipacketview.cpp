@@ -0,0 +1,268 @@
+#include "wl/communication/tcsipacketview.h"
+
+#include <etl/array.h>
+
+#include <cassert>
+
+namespace wl {
+
+namespace {
+
+enum PacketKind : uint8_t
+{
+    INVALID_PACKET = 0,
+    REQUEST_PACKET,
+    RESPONSE_PACKET,
+};
+
+constexpr etl::array<uint8_t, 256> createPacketKinds()
+{
+    etl::array<uint8_t, 256> packetKinds {};
+    for (size_t value = static_cast<uint8_t>(TCSIPacket::Status::OK); value <= static_cast<uint8_t>(TCSIPacket::Status::INCORRECT_VALUE); ++value)
+    {
+        packetKinds[value] = RESPONSE_PACKET;
+    }
+    for (size_t value = static_cast<uint8_t>(TCSIPacket::Command::READ); value <= static_cast<uint8_t>(TCSIPacket::Command::FLASH_BURST_END); ++value)
+    {
+        packetKinds[value] = REQUEST_PACKET;
+    }
+    return packetKinds;
+}
+
+// indexed by the status or command byte
+constexpr auto PACKET_KINDS = createPacketKinds();
+
+} // namespace
+
+TCSIPacketView::TCSIPacketView(etl::span<const uint8_t> packetData) :
+    m_packetData(packetData),
+    m_header(etl::unexpected<Error>(Error::TCSI__INVALID_SIZE))
+{
+    if (m_packetData.size() < TCSIPacket::MINIMUM_PACKET_SIZE)
+    {
+        return;
+    }
+
+    m_header = decodeHeader(m_packetData);
+    if (!m_header.has_value())
+    {
+        return;
+    }
+
+    if (m_header.value().payloadDataSize != m_packetData.size() - TCSIPacket::MINIMUM_PACKET_SIZE)
+    {
+        m_header = etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+        return;
+    }
+
+    m_header.value().checksumValid = m_packetData.back() == TCSIPacket::calculateCheckSum(m_packetData);
+}
+
+etl::expected<TCSIPacketView::Header, Error> TCSIPacketView::decodeHeader(etl::span<const uint8_t> packetData)
+{
+    if (packetData.size() < TCSIPacket::HEADER_SIZE)
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+    }
+
+    if (!TCSIPacket::isSynchronizationValue(packetData[TCSIPacket::SYNCHRONIZATION_AND_ID_POSITION]))
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_SYNCHRONIZATION_VALUE);
+    }
+
+    if (PACKET_KINDS[packetData[TCSIPacket::STATUS_OR_COMMAND_POSITION]] == INVALID_PACKET)
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_STATUS_OR_COMMAND);
+    }
+
+    Header header;
+    header.packetId = packetData[TCSIPacket::SYNCHRONIZATION_AND_ID_POSITION] & TCSIPacket::PACKET_ID_MASK;
+    header.statusOrCommand = packetData[TCSIPacket::STATUS_OR_COMMAND_POSITION];
+    header.address = decodeAddress(packetData);
+    header.payloadDataSize = packetData[TCSIPacket::COUNT_POSITION];
+    return header;
+}
+
+bool TCSIPacketView::isResponseStatus(uint8_t statusOrCommand)
+{
+    return PACKET_KINDS[statusOrCommand] == RESPONSE_PACKET;
+}
+
+uint32_t TCSIPacketView::decodeAddress(etl::span<const uint8_t> packetData)
+{
+    // the address field is not aligned in the packet, it is assembled from its little endian bytes
+    uint32_t address = 0;
+    for (size_t i = 0; i < sizeof(address); ++i)
+    {
+        address |= static_cast<uint32_t>(packetData[TCSIPacket::ADDRESS_POSITION + i]) << (8 * i);
+    }
+    return address;
+}
+
+etl::expected<void, Error> TCSIPacketView::validate() const
+{
+    if (!m_header.has_value())
+    {
+        return etl::unexpected<Error>(m_header.error());
+    }
+
+    if (!m_header.value().checksumValid)
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_CHECKSUM);
+    }
+
+    return {};
+}
+
+etl::expected<void, Error> TCSIPacketView::validateAsResponse(uint32_t address) const
+{
+    const auto validationResult = validate();
+    if (!validationResult.has_value())
+    {
+        return validationResult;
+    }
+
+    if (!isResponseStatus(m_header.value().statusOrCommand))
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_STATUS_OR_COMMAND);
+    }
+
+    if (m_header.value().address != address)
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_RESPONSE_ADDRESS);
+    }
+
+    return {};
+}
+
+etl::expected<void, Error> TCSIPacketView::validateAsOkResponse(uint32_t address, uint8_t payloadDataSize) const
+{
+    const auto validationResult = validateAsResponse(address);
+    if (!validationResult.has_value())
+    {
+        return validationResult;
+    }
+
+    const auto status = static_cast<TCSIPacket::Status>(m_header.value().statusOrCommand);
+    if (status != TCSIPacket::Status::OK)
+    {
+        if (status == TCSIPacket::Status::CAMERA_NOT_READY)
+        {
+            return etl::unexpected<Error>(Error::TCSI__RESPONSE_DEVICE_BUSY);
+        }
+        else if (status == TCSIPacket::Status::FLASH_BURST_ERROR)
+        {
+            return etl::unexpected<Error>(Error::TCSI__RESPONSE_FLASH_BURST_ERROR);
+        }
+        else
+        {
+            return etl::unexpected<Error>(Error::TCSI__RESPONSE_STATUS_ERROR);
+        }
+    }
+
+    if (m_header.value().payloadDataSize != payloadDataSize)
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+    }
+
+    return {};
+}
+
+etl::expected<void, Error> TCSIPacketView::validateAsRequest() const
+{
+    const auto validationResult = validate();
+    if (!validationResult.has_value())
+    {
+        return validationResult;
+    }
+
+    const uint8_t payloadDataSize = m_header.value().payloadDataSize;
+    switch (m_header.value().statusOrCommand)
+    {
+    case static_cast<uint8_t>(TCSIPacket::Command::READ):
+        if (payloadDataSize != 1)
+        {
+            return etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+        }
+        break;
+    case static_cast<uint8_t>(TCSIPacket::Command::WRITE):
+        if (payloadDataSize == 0)
+        {
+            return etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+        }
+        break;
+    case static_cast<uint8_t>(TCSIPacket::Command::FLASH_BURST_START):
+        if (payloadDataSize != 4)
+        {
+            return etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+        }
+        break;
+    case static_cast<uint8_t>(TCSIPacket::Command::FLASH_BURST_END):
+        if (payloadDataSize != 0)
+        {
+            return etl::unexpected<Error>(Error::TCSI__INVALID_SIZE);
+        }
+        break;
+
+    default:
+        return etl::unexpected<Error>(Error::TCSI__INVALID_STATUS_OR_COMMAND);
+    }
+    return {};
+}
+
+etl::expected<uint8_t, Error> TCSIPacketView::getExpectedDataSize() const
+{
+    return getExpectedDataSize(m_packetData);
+}
+
+etl::expected<uint8_t, Error> TCSIPacketView::getExpectedDataSize(etl::span<const uint8_t> packetData)
+{
+    const auto header = decodeHeader(packetData);
+    if (!header.has_value())
+    {
+        return etl::unexpected<Error>(header.error());
+    }
+
+    if (!isResponseStatus(header.value().statusOrCommand))
+    {
+        return etl::unexpected<Error>(Error::TCSI__INVALID_STATUS_OR_COMMAND);
+    }
+
+    return header.value().payloadDataSize;
+}
+
+uint8_t TCSIPacketView::getPacketId() const
+{
+    assert(validate().has_value());
+
+    return m_header.value().packetId;
+}
+
+uint8_t TCSIPacketView::getStatusOrCommand() const
+{
+    return m_packetData[TCSIPacket::STATUS_OR_COMMAND_POSITION];
+}
+
+uint32_t TCSIPacketView::getAddress() const
+{
+    return decodeAddress(m_packetData);
+}
+
+etl::span<const uint8_t> TCSIPacketView::getPayloadData() const
+{
+    assert(validate().has_value());
+
+    return getPayloadDataImpl();
+}
+
+etl::span<const uint8_t> TCSIPacketView::getPacketData() const
+{
+    return m_packetData;
+}
+
+etl::span<const uint8_t> TCSIPacketView::getPayloadDataImpl() const
+{
+    return m_packetData.subspan(TCSIPacket::HEADER_SIZE, m_packetData.size() - TCSIPacket::MINIMUM_PACKET_SIZE);
+}
+
+} // namespace wl
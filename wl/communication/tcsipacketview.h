@@ -0,0 +1,143 @@
+#ifndef WL_TCSIPACKETVIEW_H
+#define WL_TCSIPACKETVIEW_H
+
+#include "wl/communication/tcsipacket.h"
+#include "wl/error.h"
+
+#include <etl/expected.h>
+#include <etl/span.h>
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @class TCSIPacketView
+ * @headerfile tcsipacketview.h "wl/communication/tcsipacketview.h"
+ * @brief Non-owning view of a TCSI packet, validating and parsing the bytes where they were received.
+ *
+ * @details
+ * Provides the read-only part of TCSIPacket (which uses it for its own data) without copying the frame.
+ * The viewed bytes have to outlive the view and stay unchanged.
+ *
+ * The packet is decoded once by the constructor into a Header (a single walk over the bytes for the checksum and
+ * a table lookup for the status or command byte), the validation methods and getters only check the decoded fields.
+ */
+class TCSIPacketView
+{
+public:
+    /**
+     * @struct Header
+     * @brief Decoded packet header.
+     */
+    struct Header
+    {
+        uint8_t packetId {0};        ///< ID of the packet
+        uint8_t statusOrCommand {0}; ///< status (responses) or command (requests) byte
+        uint32_t address {0};        ///< address the packet refers to
+        uint8_t payloadDataSize {0}; ///< count byte, size of the payload
+        bool checksumValid {false};  ///< checksum matches, set only when the whole packet is decoded
+    };
+
+    /**
+     * @brief Constructs a view of raw packet data and decodes it.
+     * @param packetData The raw packet data, not copied.
+     */
+    explicit TCSIPacketView(etl::span<const uint8_t> packetData);
+
+    /**
+     * @brief Decodes the header of a packet, only the header has to be available.
+     * @param packetData The raw packet data, at least TCSIPacket::HEADER_SIZE bytes.
+     * @return An `etl::expected<Header, Error>` containing the header (without the checksum checked) or an error.
+     * @retval Error::TCSI__INVALID_SIZE if packet data are shorter than the header
+     * @retval Error::TCSI__INVALID_SYNCHRONIZATION_VALUE if packet syncrhonization value is invalid
+     * @retval Error::TCSI__INVALID_STATUS_OR_COMMAND if packet status or command byte is invalid
+     */
+    [[nodiscard]] static etl::expected<Header, Error> decodeHeader(etl::span<const uint8_t> packetData);
+
+    /**
+     * @brief Calculates the expected size of the data payload of a response without decoding the whole packet.
+     * @param packetData The raw packet data, at least TCSIPacket::HEADER_SIZE bytes.
+     * @return An `etl::expected<uint8_t, Error>` containing the expected data size or an error, see TCSIPacket::getExpectedDataSize.
+     */
+    [[nodiscard]] static etl::expected<uint8_t, Error> getExpectedDataSize(etl::span<const uint8_t> packetData);
+
+    /**
+     * @brief Validates the packet's structure.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     * @retval Error::TCSI__INVALID_SIZE if packet data size is invalid
+     * @retval Error::TCSI__INVALID_SYNCHRONIZATION_VALUE if packet syncrhonization value is invalid
+     * @retval Error::TCSI__INVALID_STATUS_OR_COMMAND if packet status or command byte is invalid
+     * @retval Error::TCSI__INVALID_CHECKSUM if checksum is incorrect
+     */
+    [[nodiscard]] etl::expected<void, Error> validate() const;
+
+    /**
+     * @brief Validates the packet as a response packet for a specified address.
+     * @param address The expected address in the response.
+     * @return An `etl::expected<void, Error>` indicating success or error, see TCSIPacket::validateAsResponse.
+     */
+    [[nodiscard]] etl::expected<void, Error> validateAsResponse(uint32_t address) const;
+
+    /**
+     * @brief Validates the packet as an OK response with a specified address and payload size.
+     * @param address The expected address in the response.
+     * @param payloadDataSize The expected size of the payload data.
+     * @return An `etl::expected<void, Error>` indicating success or error, see TCSIPacket::validateAsOkResponse.
+     */
+    [[nodiscard]] etl::expected<void, Error> validateAsOkResponse(uint32_t address, uint8_t payloadDataSize) const;
+
+    /**
+     * @brief Validates the packet as a request packet.
+     * @return An `etl::expected<void, Error>` indicating success or error, see TCSIPacket::validateAsRequest.
+     */
+    [[nodiscard]] etl::expected<void, Error> validateAsRequest() const;
+
+    /**
+     * @brief Calculates the expected size of the data payload, only the header has to be viewed.
+     * @return An `etl::expected<uint8_t, Error>` containing the expected data size or an error, see TCSIPacket::getExpectedDataSize.
+     */
+    [[nodiscard]] etl::expected<uint8_t, Error> getExpectedDataSize() const;
+
+    /**
+     * @brief Retrieves the packet ID.
+     * @return The packet ID.
+     */
+    uint8_t getPacketId() const;
+
+    /**
+     * @brief Retrieves the status (responses) or command (requests) byte.
+     * @return The status or command byte, compare with TCSIPacket::Status or TCSIPacket::Command values.
+     */
+    uint8_t getStatusOrCommand() const;
+
+    /**
+     * @brief Retrieves the address the packet refers to.
+     * @return The address.
+     */
+    uint32_t getAddress() const;
+
+    /**
+     * @brief Retrieves the data payload as a span.
+     * @return A span of the payload bytes inside the viewed data.
+     */
+    etl::span<const uint8_t> getPayloadData() const;
+
+    /**
+     * @brief Retrieves the entire viewed packet data.
+     * @return A span of the packet bytes.
+     */
+    etl::span<const uint8_t> getPacketData() const;
+
+private:
+    etl::span<const uint8_t> getPayloadDataImpl() const;
+    static bool isResponseStatus(uint8_t statusOrCommand);
+    static uint32_t decodeAddress(etl::span<const uint8_t> packetData);
+
+    etl::span<const uint8_t> m_packetData;
+    etl::expected<Header, Error> m_header;
+};
+
+} // namespace wl
+
+#endif // WL_TCSIPACKETVIEW_H
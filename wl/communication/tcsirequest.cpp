@@ -0,0 +1,93 @@
+#include "wl/communication/tcsirequest.h"
+
+#include "wl/misc/endian.h"
+
+#include <etl/algorithm.h>
+#include <etl/numeric.h>
+
+#include <cassert>
+
+namespace wl {
+
+TCSIRequest::TCSIRequest(TCSIPacket::Command command, uint8_t packetId, uint32_t address, etl::span<const uint8_t> payloadData, bool storePayload)
+{
+    assert(payloadData.size() <= TCSIPacket::MAXIMUM_PAYLOAD_SIZE);
+    assert(!storePayload || payloadData.size() <= MAXIMUM_STORED_PAYLOAD_SIZE);
+
+    m_data.at(TCSIPacket::SYNCHRONIZATION_AND_ID_POSITION) = (TCSIPacket::SYNCHRONIZATION_MASK & TCSIPacket::SYNCHRONIZATION_VALUE) | (TCSIPacket::PACKET_ID_MASK & packetId);
+    m_data.at(TCSIPacket::STATUS_OR_COMMAND_POSITION) = static_cast<uint8_t>(command);
+    serialize(toLittleEndian(address), m_data.data() + TCSIPacket::ADDRESS_POSITION, sizeof(address));
+    m_data.at(TCSIPacket::COUNT_POSITION) = payloadData.size();
+
+    const auto header = etl::span<const uint8_t>(m_data.data(), TCSIPacket::HEADER_SIZE);
+    const uint8_t checksum = etl::accumulate(payloadData.begin(), payloadData.end(), etl::accumulate(header.begin(), header.end(), uint8_t(0)));
+
+    if (storePayload)
+    {
+        etl::copy(payloadData.begin(), payloadData.end(), m_data.begin() + TCSIPacket::DATA_POSITION);
+        m_storedPayloadSize = payloadData.size();
+    }
+    else
+    {
+        m_payloadData = payloadData;
+    }
+    m_data.at(TCSIPacket::DATA_POSITION + m_storedPayloadSize) = checksum;
+}
+
+TCSIRequest TCSIRequest::createReadRequest(uint8_t packetId, uint32_t address, uint8_t payloadDataSize)
+{
+    const etl::array<uint8_t, 1> payloadData {payloadDataSize};
+    return TCSIRequest(TCSIPacket::Command::READ, packetId, address, payloadData, true);
+}
+
+TCSIRequest TCSIRequest::createWriteRequest(uint8_t packetId, uint32_t address, etl::span<const uint8_t> payloadData)
+{
+    return TCSIRequest(TCSIPacket::Command::WRITE, packetId, address, payloadData, false);
+}
+
+TCSIRequest TCSIRequest::createBurstStartRequest(uint8_t packetId, uint32_t address)
+{
+    const etl::array<uint8_t, 4> payloadData {0, 0, 0, 1};
+    return TCSIRequest(TCSIPacket::Command::FLASH_BURST_START, packetId, address, payloadData, true);
+}
+
+TCSIRequest TCSIRequest::createBurstEndRequest(uint8_t packetId, uint32_t address)
+{
+    return TCSIRequest(TCSIPacket::Command::FLASH_BURST_END, packetId, address, etl::span<const uint8_t>(), true);
+}
+
+uint8_t TCSIRequest::getPacketId() const
+{
+    return m_data.at(TCSIPacket::SYNCHRONIZATION_AND_ID_POSITION) & TCSIPacket::PACKET_ID_MASK;
+}
+
+TCSIPacket::Command TCSIRequest::getCommand() const
+{
+    return static_cast<TCSIPacket::Command>(m_data.at(TCSIPacket::STATUS_OR_COMMAND_POSITION));
+}
+
+etl::span<const uint8_t> TCSIRequest::getPayloadData() const
+{
+    if (!m_payloadData.empty())
+    {
+        return m_payloadData;
+    }
+    return etl::span<const uint8_t>(m_data.data() + TCSIPacket::DATA_POSITION, m_storedPayloadSize);
+}
+
+size_t TCSIRequest::getSize() const
+{
+    return TCSIPacket::MINIMUM_PACKET_SIZE + getPayloadData().size();
+}
+
+etl::array<etl::span<const uint8_t>, 3> TCSIRequest::getParts() const
+{
+    if (m_payloadData.empty())
+    {
+        return {etl::span<const uint8_t>(m_data.data(), TCSIPacket::MINIMUM_PACKET_SIZE + m_storedPayloadSize), etl::span<const uint8_t>(), etl::span<const uint8_t>()};
+    }
+    return {etl::span<const uint8_t>(m_data.data(), TCSIPacket::HEADER_SIZE), m_payloadData,
+            etl::span<const uint8_t>(m_data.data() + TCSIPacket::DATA_POSITION, 1)};
+}
+
+} // namespace wl
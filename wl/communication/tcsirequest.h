@@ -0,0 +1,104 @@
+#ifndef WL_TCSIREQUEST_H
+#define WL_TCSIREQUEST_H
+
+#include "wl/communication/tcsipacket.h"
+
+#include <etl/array.h>
+#include <etl/span.h>
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @class TCSIRequest
+ * @headerfile tcsirequest.h "wl/communication/tcsirequest.h"
+ * @brief TCSI request frame sent as a gather list, without copying the payload.
+ *
+ * @details
+ * Holds the header and the checksum of the request. Payload of a write request stays in the caller's buffer, which
+ * has to outlive the request, and getParts() returns the header, the payload and the checksum to be passed to
+ * IDataLinkInterface::writeGather. Small payloads of the other requests (read size, burst start) are stored with
+ * the header, so those requests are a single part.
+ */
+class TCSIRequest
+{
+public:
+    /**
+     * @brief Creates a read request.
+     * @param packetId The ID of the packet.
+     * @param address The memory address for the read operation.
+     * @param payloadDataSize The size of the data to read.
+     * @return The read request.
+     */
+    [[nodiscard]] static TCSIRequest createReadRequest(uint8_t packetId, uint32_t address, uint8_t payloadDataSize);
+
+    /**
+     * @brief Creates a write request referring to the payload.
+     * @param packetId The ID of the packet.
+     * @param address The memory address for the write operation.
+     * @param payloadData The data to be written, not copied.
+     * @return The write request.
+     */
+    [[nodiscard]] static TCSIRequest createWriteRequest(uint8_t packetId, uint32_t address, etl::span<const uint8_t> payloadData);
+
+    /**
+     * @brief Creates a burst start request.
+     * @param packetId The ID of the packet.
+     * @param address The flash address for the write operation.
+     * @return The burst start request.
+     */
+    [[nodiscard]] static TCSIRequest createBurstStartRequest(uint8_t packetId, uint32_t address);
+
+    /**
+     * @brief Creates a burst end request.
+     * @param packetId The ID of the packet.
+     * @param address The memory address for the burst end operation.
+     * @return The burst end request.
+     */
+    [[nodiscard]] static TCSIRequest createBurstEndRequest(uint8_t packetId, uint32_t address);
+
+    /**
+     * @brief Retrieves the packet ID.
+     * @return The packet ID.
+     */
+    uint8_t getPacketId() const;
+
+    /**
+     * @brief Retrieves the command.
+     * @return The command of the request.
+     */
+    TCSIPacket::Command getCommand() const;
+
+    /**
+     * @brief Retrieves the payload of the request.
+     * @return Span of the payload bytes.
+     */
+    etl::span<const uint8_t> getPayloadData() const;
+
+    /**
+     * @brief Retrieves the size of the whole frame.
+     * @return Number of bytes sent on the data link.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Retrieves the frame as a gather list: header, payload and checksum, empty parts are skipped by data links.
+     * @return Spans to be sent in order, valid while the request and the payload exist.
+     */
+    etl::array<etl::span<const uint8_t>, 3> getParts() const;
+
+private:
+    TCSIRequest(TCSIPacket::Command command, uint8_t packetId, uint32_t address, etl::span<const uint8_t> payloadData, bool storePayload);
+
+    static constexpr size_t MAXIMUM_STORED_PAYLOAD_SIZE = 4; ///< burst start payload
+
+    // header, stored payload and checksum
+    etl::array<uint8_t, TCSIPacket::MINIMUM_PACKET_SIZE + MAXIMUM_STORED_PAYLOAD_SIZE> m_data {};
+    size_t m_storedPayloadSize {0};
+    etl::span<const uint8_t> m_payloadData;
+};
+
+} // namespace wl
+
+#endif // WL_TCSIREQUEST_H
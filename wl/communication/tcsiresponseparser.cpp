@@ -0,0 +1,144 @@
+#include "wl/communication/tcsiresponseparser.h"
+
+#include <etl/algorithm.h>
+#include <etl/optional.h>
+
+#include <cassert>
+
+
+namespace wl {
+
+size_t TCSIResponseParser::getMissingSize() const
+{
+    if (m_frame.has_value())
+    {
+        return 0;
+    }
+
+    if (m_frameSize == 0)
+    {
+        return TCSIPacket::MINIMUM_PACKET_SIZE - m_size;
+    }
+
+    assert(m_frameSize > m_size);
+    return m_frameSize - m_size;
+}
+
+etl::span<uint8_t> TCSIResponseParser::prepare(size_t size)
+{
+    // consumed frames and skipped bytes are dropped only here, the remaining bytes are usually none or a few
+    if (m_begin > 0)
+    {
+        etl::copy(m_buffer.begin() + m_begin, m_buffer.begin() + m_begin + m_size, m_buffer.begin());
+        m_begin = 0;
+    }
+    return etl::span<uint8_t>(m_buffer).subspan(m_size, std::min(size, m_buffer.size() - m_size));
+}
+
+void TCSIResponseParser::commit(size_t size)
+{
+    assert(m_begin == 0);
+    assert(m_size + size <= m_buffer.size());
+    m_size += size;
+}
+
+etl::expected<bool, Error> TCSIResponseParser::parse()
+{
+    if (m_frame.has_value())
+    {
+        return true;
+    }
+
+    etl::optional<Error> skippedFrameError;
+    while (true)
+    {
+        synchronize();
+
+        if (m_size < TCSIPacket::MINIMUM_PACKET_SIZE)
+        {
+            m_frameSize = 0;
+            break;
+        }
+
+        const auto expectedDataSize = TCSIPacketView::getExpectedDataSize(etl::span<const uint8_t>(m_buffer.data() + m_begin, TCSIPacket::HEADER_SIZE));
+        if (!expectedDataSize.has_value())
+        {
+            // invalid status - not a frame start
+            skip(1);
+            continue;
+        }
+
+        m_frameSize = TCSIPacket::MINIMUM_PACKET_SIZE + expectedDataSize.value();
+        if (m_size < m_frameSize)
+        {
+            break;
+        }
+
+        // decoded once, the view keeps the header for the validation of the response
+        const TCSIPacketView frame(etl::span<const uint8_t>(m_buffer.data() + m_begin, m_frameSize));
+        if (const auto validationResult = frame.validate(); !validationResult.has_value())
+        {
+            skippedFrameError = validationResult.error();
+            m_frameSize = 0;
+            skip(1);
+            continue;
+        }
+
+        m_frame = frame;
+        return true;
+    }
+
+    if (skippedFrameError.has_value())
+    {
+        return etl::unexpected<Error>(skippedFrameError.value());
+    }
+    return false;
+}
+
+const TCSIPacketView& TCSIResponseParser::getFrame() const
+{
+    assert(m_frame.has_value());
+    return m_frame.value();
+}
+
+void TCSIResponseParser::consumeFrame()
+{
+    assert(m_frame.has_value());
+    m_begin += m_frameSize;
+    m_size -= m_frameSize;
+    m_frame.reset();
+    m_frameSize = 0;
+}
+
+void TCSIResponseParser::reset()
+{
+    m_begin = 0;
+    m_size = 0;
+    m_frameSize = 0;
+    m_frame.reset();
+}
+
+size_t TCSIResponseParser::getSkippedSize() const
+{
+    return m_skippedSize;
+}
+
+void TCSIResponseParser::skip(size_t size)
+{
+    assert(size <= m_size);
+    m_begin += size;
+    m_size -= size;
+    m_skippedSize += size;
+}
+
+void TCSIResponseParser::synchronize()
+{
+    const auto begin = m_buffer.begin() + m_begin;
+    const auto synchronizedBegin = std::find_if(begin, begin + m_size, [](uint8_t value)
+    {
+        return TCSIPacket::isSynchronizationValue(value);
+    });
+    skip(synchronizedBegin - begin);
+}
+
+} // namespace wl
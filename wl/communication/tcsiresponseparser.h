@@ -0,0 +1,103 @@
+#ifndef WL_TCSIRESPONSEPARSER_H
+#define WL_TCSIRESPONSEPARSER_H
+
+#include "wl/communication/tcsipacket.h"
+#include "wl/communication/tcsipacketview.h"
+#include "wl/error.h"
+
+#include <etl/array.h>
+#include <etl/expected.h>
+#include <etl/optional.h>
+#include <etl/span.h>
+
+#include <cstdint>
+#include <stddef.h>
+
+namespace wl {
+
+/**
+ * @class TCSIResponseParser
+ * @headerfile tcsiresponseparser.h "wl/communication/tcsiresponseparser.h"
+ * @brief Incremental parser extracting TCSI response frames from a byte stream.
+ *
+ * @details
+ * Received bytes are appended using prepare() / commit(). parse() looks for the synchronization nibble,
+ * checks the header and the checksum and resynchronizes on the next candidate frame when any of the checks
+ * fails, so a corrupted byte costs only the bytes that have to be skipped instead of a flush of the whole line.
+ *
+ * getMissingSize() never asks for more bytes than the end of the frame at the front of the buffer, so a blocking
+ * data link read of exactly that size never consumes bytes of the following frame.
+ */
+class TCSIResponseParser
+{
+public:
+    /**
+     * @brief Retrieves the number of bytes needed before parse() can make progress.
+     * @return Number of missing bytes, 0 when a complete frame is ready.
+     */
+    size_t getMissingSize() const;
+
+    /**
+     * @brief Retrieves free space at the end of the internal buffer for received data.
+     * @param size Requested size, clamped to the free space.
+     * @return Span to be filled with received bytes and confirmed by commit().
+     */
+    etl::span<uint8_t> prepare(size_t size);
+
+    /**
+     * @brief Confirms bytes stored into the span returned by prepare().
+     * @param size Number of bytes received.
+     */
+    void commit(size_t size);
+
+    /**
+     * @brief Tries to extract a complete frame from the received data.
+     *
+     * Bytes that cannot start a valid frame are skipped. A complete frame with an invalid checksum or size is
+     * skipped as well and reported by the error, parsing then continues on the data following its first byte.
+     * @return `true` if a frame is ready (see getFrame()), `false` if more data is needed or an error.
+     * @retval Error::TCSI__INVALID_CHECKSUM if a complete frame had invalid checksum and was skipped
+     * @retval Error::TCSI__INVALID_SIZE if a complete frame had invalid size and was skipped
+     */
+    [[nodiscard]] etl::expected<bool, Error> parse();
+
+    /**
+     * @brief Retrieves the frame found by the last successful parse(), in place in the internal buffer.
+     * @return View of the whole frame (header, payload and checksum) with the header already decoded, the viewed
+     * bytes are valid until the next prepare() or reset().
+     */
+    const TCSIPacketView& getFrame() const;
+
+    /**
+     * @brief Removes the frame found by the last successful parse() from the buffer.
+     *
+     * The frame bytes are released by the next prepare(), so a copy of the view from getFrame() can still be read.
+     */
+    void consumeFrame();
+
+    /**
+     * @brief Discards all buffered data.
+     */
+    void reset();
+
+    /**
+     * @brief Retrieves the total number of bytes skipped while resynchronizing.
+     * @return Number of skipped bytes since construction.
+     */
+    size_t getSkippedSize() const;
+
+private:
+    void skip(size_t size);
+    void synchronize();
+
+    etl::array<uint8_t, TCSIPacket::MAXIMUM_PACKET_SIZE> m_buffer {};
+    size_t m_begin {0}; // start of unparsed data, the buffer is compacted by prepare()
+    size_t m_size {0};
+    size_t m_frameSize {0};
+    etl::optional<TCSIPacketView> m_frame;
+    size_t m_skippedSize {0};
+};
+
+} // namespace wl
+
+#endif // WL_TCSIRESPONSEPARSER_H
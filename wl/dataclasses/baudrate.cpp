@@ -0,0 +1,26 @@
+#include "wl/dataclasses/baudrate.h"
+
+#include <cassert>
+
+namespace wl {
+
+uint32_t Baudrate::getBitsPerSecond(Baudrate item)
+{
+    switch (item)
+    {
+        case B_115200:
+            return 115200;
+
+        case B_921600:
+            return 921600;
+
+        case B_3000000:
+            return 3000000;
+
+        default:
+            assert(false);
+            return 0;
+    }
+}
+
+} // namespace wl
@@ -25,6 +25,13 @@ struct Baudrate
         B_3000000 = 9
     };
 
+    /**
+     * @brief Gets the line speed of the given baudrate.
+     * @param item The baudrate item.
+     * @return The line speed in bits per second.
+     */
+    static uint32_t getBitsPerSecond(Baudrate item);
+
     ETL_DECLARE_ENUM_TYPE(Baudrate, uint8_t)
     ETL_ENUM_TYPE(B_115200, "B_115200")
     ETL_ENUM_TYPE(B_921600, "B_921600")
@@ -0,0 +1,103 @@
+#ifndef WL_CONFIGURATIONSNAPSHOT_H
+#define WL_CONFIGURATIONSNAPSHOT_H
+
+#include "wl/dataclasses/agcnhsmoothing.h"
+#include "wl/dataclasses/auxpin.h"
+#include "wl/dataclasses/baudrate.h"
+#include "wl/dataclasses/contrastbrightness.h"
+#include "wl/dataclasses/firmwareversion.h"
+#include "wl/dataclasses/framerate.h"
+#include "wl/dataclasses/imageequalizationtype.h"
+#include "wl/dataclasses/imageflip.h"
+#include "wl/dataclasses/imagegenerator.h"
+#include "wl/dataclasses/internalshutterposition.h"
+#include "wl/dataclasses/presetid.h"
+#include "wl/dataclasses/reticletype.h"
+#include "wl/dataclasses/shutterupdatemode.h"
+#include "wl/dataclasses/status.h"
+#include "wl/dataclasses/timedomainaveraging.h"
+#include "wl/dataclasses/triggermode.h"
+#include "wl/dataclasses/triggers.h"
+#include "wl/dataclasses/videoformat.h"
+#include "wl/weom/memoryspaceweom.h"
+
+#include <etl/string.h>
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @struct ConfigurationSnapshot
+ * @headerfile configurationsnapshot.h "wl/dataclasses/configurationsnapshot.h"
+ * @brief Decoded content of the WEOM registers read at once by `WEOM::readSnapshot`.
+ *
+ * Each member holds the value the corresponding `WEOM` getter would return.
+ * @see registers
+ */
+struct ConfigurationSnapshot
+{
+    // Control
+    Status status {};     ///< @see WEOM::getStatus
+    Triggers triggers {}; ///< @see WEOM::getTriggers
+
+    // General
+    FirmwareVersion firmwareVersion {};                                                  ///< @see WEOM::getFirmwareVersion
+    double shutterTemperature {0};                                                       ///< @see WEOM::getShutterTemperature
+    etl::string<MemorySpaceWEOM::SERIAL_NUMBER_CURRENT.getSize() + 1> serialNumber {};   ///< @see WEOM::getSerialNumber
+    etl::string<MemorySpaceWEOM::ARTICLE_NUMBER_CURRENT.getSize() + 1> articleNumber {}; ///< @see WEOM::getArticleNumber
+    uint8_t ledRedBrightness {0};                                                        ///< @see WEOM::getLedRedBrightness
+    uint8_t ledGreenBrightness {0};                                                      ///< @see WEOM::getLedGreenBrightness
+    uint8_t ledBlueBrightness {0};                                                       ///< @see WEOM::getLedBlueBrightness
+    TriggerMode triggerMode {};                                                          ///< @see WEOM::getTriggerMode
+    AuxPin auxPin0 {};                                                                   ///< @see WEOM::getAuxPin
+    AuxPin auxPin1 {};                                                                   ///< @see WEOM::getAuxPin
+    AuxPin auxPin2 {};                                                                   ///< @see WEOM::getAuxPin
+
+    // Video
+    uint8_t paletteIndex {0};         ///< @see WEOM::getPaletteIndex
+    Framerate framerate {};           ///< @see WEOM::getFramerate
+    ImageFlip imageFlip {};           ///< @see WEOM::getImageFlip
+    bool imageFreeze {false};         ///< @see WEOM::getImageFreeze
+    VideoFormat videoFormat {};       ///< @see WEOM::getVideoFormat
+    ImageGenerator imageGenerator {}; ///< @see WEOM::getImageGenerator
+    ReticleType reticleType {};       ///< @see WEOM::getReticleType
+    int32_t reticlePositionX {0};     ///< @see WEOM::getReticlePositionX
+    int32_t reticlePositionY {0};     ///< @see WEOM::getReticlePositionY
+
+    // NUC
+    uint32_t shutterCounter {0};                         ///< @see WEOM::getShutterCounter
+    uint32_t timeFromLastNucOffsetUpdate {0};            ///< @see WEOM::getTimeFromLastNucOffsetUpdate
+    ShutterUpdateMode shutterUpdateMode {};              ///< @see WEOM::getShutterUpdateMode
+    InternalShutterPosition internalShutterPosition {};  ///< @see WEOM::getInternalShutterPosition
+    uint16_t shutterMaxPeriod {0};                       ///< @see WEOM::getShutterMaxPeriod
+    double shutterAdaptiveThreshold {0};                 ///< @see WEOM::getShutterAdaptiveThreshold
+
+    // Connection
+    Baudrate uartBaudrate {}; ///< @see WEOM::getUartBaudrate
+
+    // Filters
+    TimeDomainAveraging timeDomainAveraging {};          ///< @see WEOM::getTimeDomainAveraging
+    ImageEqualizationType imageEqualizationType {};      ///< @see WEOM::getImageEqualizationType
+    ContrastBrightness mgcContrastBrightness {};         ///< @see WEOM::getMgcContrastBrightness
+    ContrastBrightness frameBlockMedianConbright {};     ///< @see WEOM::getFrameBlockMedianConbright
+    AGCNHSmoothing agcNhSmoothingFrames {};              ///< @see WEOM::getAgcNhSmoothingFrames
+    bool spatialMedianFilterEnabled {false};             ///< @see WEOM::getSpatialMedianFilterEnabled
+    uint8_t linearGainWeight {0};                        ///< @see WEOM::getLinearGainWeight
+    uint8_t clipLimit {0};                               ///< @see WEOM::getClipLimit
+    uint8_t plateauTailRejection {0};                    ///< @see WEOM::getPlateauTailRejection
+    uint8_t smartTimeDomainAverageThreshold {0};         ///< @see WEOM::getSmartTimeDomainAverageThreshold
+    uint8_t smartMedianThreshold {0};                    ///< @see WEOM::getSmartMedianThreshold
+    double gammaCorrection {0};                          ///< @see WEOM::getGammaCorrection
+    double maxAmplification {0};                         ///< @see WEOM::getMaxAmplification
+    uint8_t dampingFactor {0};                           ///< @see WEOM::getDampingFactor
+
+    // Presets
+    PresetId presetId {};      ///< Current preset ID, @see WEOM::getPresetId
+    uint8_t presetIndex {0};   ///< @see WEOM::getPresetIndex
+    uint8_t presetIdCount {0}; ///< @see WEOM::getPresetIdCount
+};
+
+} // namespace wl
+
+#endif // WL_CONFIGURATIONSNAPSHOT_H
@@ -3,7 +3,6 @@
 
 #include <etl/enum_type.h>
 #include <etl/exception.h>
-#include <iostream>
 
 namespace wl
 {
@@ -16,30 +15,21 @@ namespace wl
     struct Error
     {
         /**
-         * @brief Writes error message to stdout
+         * @brief Writes error message to the log sink (see Logger) as LogLevel::FAILURE
          * @param e Error exception
          */
-        static void log(const etl::exception &e)
-        {
-#ifdef WL_ENABLE_LOGGING
-            std::cout << "The error was " << e.what() << " in " << e.file_name() << " at "
-                      << e.line_number() << "\n";
-#endif
-        }
+        static void log(const etl::exception &e);
 
         /**
-         * @brief Write a string message to stdout
+         * @brief Write a string message to the log sink (see Logger) as LogLevel::INFO
          * @param msg Message string
-         */          
-        static void log(const char *msg)
-        {
-#ifdef WL_ENABLE_LOGGING
-            std::cout << msg << "\n";
-#endif
-        }
+         */
+        static void log(const char *msg);
 
         /**
          * @brief Enumeration of error codes.
+         *
+         * Values are stored (e.g. in traces), new codes are added at the end only.
          */
         enum enum_type
         {
@@ -65,7 +55,10 @@ namespace wl
             DEVICE__BUSY,              ///< Device busy for more than allowed time
             DEVICE__INVALID_PIN,       ///< Invalin pin number
 
-            INVALID_DATA ///< Invalid data for conversion
+            INVALID_DATA, ///< Invalid data for conversion
+
+            TCSI__RESPONSE_FLASH_BURST_ERROR, ///< TCSI packet status is flash burst error
+            DATALINK__UNSUPPORTED_BAUDRATE, ///< Data link cannot change to the baud rate
         };
 
         ETL_DECLARE_ENUM_TYPE(Error, int)
@@ -86,6 +79,8 @@ namespace wl
         ETL_ENUM_TYPE(DEVICE__DISCONNECTED, "DEVICE__DISCONNECTED")
         ETL_ENUM_TYPE(DEVICE__BUSY, "DEVICE__BUSY")
         ETL_ENUM_TYPE(INVALID_DATA, "INVALID_DATA")
+        ETL_ENUM_TYPE(TCSI__RESPONSE_FLASH_BURST_ERROR, "TCSI__RESPONSE_FLASH_BURST_ERROR")
+        ETL_ENUM_TYPE(DATALINK__UNSUPPORTED_BAUDRATE, "DATALINK__UNSUPPORTED_BAUDRATE")
         ETL_END_ENUM_TYPE
     };
 
@@ -0,0 +1,111 @@
+#include "wl/misc/logger.h"
+
+#include <cstdio>
+
+namespace wl {
+
+namespace {
+
+class StdoutLogSink : public ILogSink
+{
+public:
+    virtual void write(const LogRecord& record) override
+    {
+        std::printf("[%s] %s", Logger::getLevelName(record.level), record.message);
+        if (record.error.has_value())
+        {
+            std::printf(" error=%s", record.error.value().c_str());
+        }
+        if (record.address.has_value())
+        {
+            std::printf(" address=0x%08lX", static_cast<unsigned long>(record.address.value()));
+        }
+        if (record.packetId.has_value())
+        {
+            std::printf(" packetId=%u", static_cast<unsigned>(record.packetId.value()));
+        }
+        std::printf("\n");
+    }
+};
+
+StdoutLogSink stdoutSink;
+ILogSink* sink = &stdoutSink;
+LogLevel level = LogLevel::INFO;
+
+} // namespace
+
+void Logger::setSink(ILogSink* newSink)
+{
+    sink = newSink;
+}
+
+ILogSink* Logger::getSink()
+{
+    return sink;
+}
+
+void Logger::setLevel(LogLevel newLevel)
+{
+    level = newLevel;
+}
+
+LogLevel Logger::getLevel()
+{
+    return level;
+}
+
+bool Logger::isEnabled(LogLevel recordLevel)
+{
+    return sink && recordLevel != LogLevel::NONE && recordLevel >= level;
+}
+
+void Logger::write(const LogRecord& record)
+{
+    if (isEnabled(record.level))
+    {
+        sink->write(record);
+    }
+}
+
+const char* Logger::getLevelName(LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::VERBOSE:
+            return "VERBOSE";
+        case LogLevel::INFO:
+            return "INFO";
+        case LogLevel::WARNING:
+            return "WARNING";
+        case LogLevel::FAILURE:
+            return "FAILURE";
+        case LogLevel::NONE:
+            return "NONE";
+    }
+    return "";
+}
+
+ILogSink& Logger::getStdoutSink()
+{
+    return stdoutSink;
+}
+
+// declared in wl/error.h, which cannot include the logger
+void Error::log([[maybe_unused]] const etl::exception& e)
+{
+#ifdef WL_ENABLE_LOGGING
+    if (Logger::isEnabled(LogLevel::FAILURE))
+    {
+        char message[200];
+        std::snprintf(message, sizeof(message), "%s in %s at %d", e.what(), e.file_name(), static_cast<int>(e.line_number()));
+        Logger::write(LogRecord {.level = LogLevel::FAILURE, .message = message});
+    }
+#endif
+}
+
+void Error::log([[maybe_unused]] const char* msg)
+{
+    WL_LOG(LogLevel::INFO, msg);
+}
+
+} // namespace wl
@@ -0,0 +1,154 @@
+#ifndef WL_LOGGER_H
+#define WL_LOGGER_H
+
+#include "wl/error.h"
+
+#include <etl/optional.h>
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @enum LogLevel
+ * @brief Severity of a log record.
+ */
+enum class LogLevel : uint8_t
+{
+    VERBOSE, ///< Details of the communication, e.g. rejected responses.
+    INFO,    ///< Notable events.
+    WARNING, ///< Recoverable failures, e.g. retried transfers.
+    FAILURE, ///< Failures returned to the caller.
+    NONE,    ///< Filters out all records.
+};
+
+/**
+ * @struct LogRecord
+ * @headerfile logger.h "wl/misc/logger.h"
+ * @brief Structured log message, the fields are formatted only by the sink.
+ */
+struct LogRecord
+{
+    LogLevel level {LogLevel::INFO};    ///< Severity.
+    const char* message {""};           ///< Constant text of the message.
+    etl::optional<Error> error {};      ///< Error the message is about.
+    etl::optional<uint32_t> address {}; ///< Device address.
+    etl::optional<uint8_t> packetId {}; ///< TCSI packet ID.
+};
+
+/**
+ * @class ILogSink
+ * @headerfile logger.h "wl/misc/logger.h"
+ * @brief Destination of the log records, e.g. the console, a file or a log of the platform.
+ */
+class ILogSink
+{
+public:
+    virtual ~ILogSink() {}
+
+    /**
+     * @brief Writes a record.
+     * @param record The record, its message is valid only during the call.
+     */
+    virtual void write(const LogRecord& record) = 0;
+};
+
+/**
+ * @class Logger
+ * @headerfile logger.h "wl/misc/logger.h"
+ * @brief Global sink and level filter of the log records written by WEOMlink.
+ *
+ * @details
+ * Records are written only when the library is built with `WL_ENABLE_LOGGING` (CMake option `WEOMLINK_ENABLE_LOGGING`),
+ * otherwise the WL_LOG macro compiles to nothing. Records below `WL_LOG_MINIMUM_LEVEL` (index of LogLevel, default 0)
+ * are removed at compile time, records below getLevel() are dropped before anything is formatted.
+ *
+ * By default the records are printed to stdout. Set the sink and the level before using WEOMlink, they are not guarded
+ * against concurrent changes.
+ * @code
+ * class EspLogSink : public wl::ILogSink
+ * {
+ *     void write(const wl::LogRecord& record) override
+ *     {
+ *         ESP_LOGW("weomlink", "%s %s", record.message, record.error.has_value() ? record.error.value().c_str() : "");
+ *     }
+ * };
+ * @endcode
+ */
+class Logger
+{
+public:
+    /**
+     * @brief Sets the destination of the records.
+     * @param sink The sink, it has to outlive its use; nullptr drops all records.
+     */
+    static void setSink(ILogSink* sink);
+
+    /**
+     * @brief Retrieves the destination of the records.
+     * @return The sink, nullptr if records are dropped.
+     */
+    static ILogSink* getSink();
+
+    /**
+     * @brief Sets the lowest level of records passed to the sink.
+     * @param level The level, default is LogLevel::INFO.
+     */
+    static void setLevel(LogLevel level);
+
+    /**
+     * @brief Retrieves the lowest level of records passed to the sink.
+     * @return The level.
+     */
+    static LogLevel getLevel();
+
+    /**
+     * @brief Checks if records of a level reach the sink.
+     * @param level The level.
+     * @return true if a sink is set and the level is not filtered out.
+     */
+    static bool isEnabled(LogLevel level);
+
+    /**
+     * @brief Passes a record to the sink if its level is enabled.
+     * @param record The record.
+     */
+    static void write(const LogRecord& record);
+
+    /**
+     * @brief Retrieves the name of a level.
+     * @param level The level.
+     * @return Upper case name, e.g. "WARNING".
+     */
+    static const char* getLevelName(LogLevel level);
+
+    /**
+     * @brief Retrieves the sink printing records to stdout, the default one.
+     * @return The sink.
+     */
+    static ILogSink& getStdoutSink();
+};
+
+#ifndef WL_LOG_MINIMUM_LEVEL
+#define WL_LOG_MINIMUM_LEVEL 0
+#endif
+
+/// Lowest level of records compiled in, set by `WL_LOG_MINIMUM_LEVEL`.
+inline constexpr LogLevel LOG_MINIMUM_LEVEL = static_cast<LogLevel>(WL_LOG_MINIMUM_LEVEL);
+
+} // namespace wl
+
+#ifdef WL_ENABLE_LOGGING
+/// Writes a record, the optional arguments are designated initializers of the wl::LogRecord fields following the message.
+#define WL_LOG(logLevel, logMessage, ...) \
+    do { \
+        if ((logLevel) >= ::wl::LOG_MINIMUM_LEVEL && ::wl::Logger::isEnabled(logLevel)) \
+        { \
+            ::wl::Logger::write(::wl::LogRecord {.level = (logLevel), .message = (logMessage) __VA_OPT__(,) __VA_ARGS__}); \
+        } \
+    } while (false)
+#else
+#define WL_LOG(logLevel, logMessage, ...) do {} while (false)
+#endif
+
+#endif // WL_LOGGER_H
@@ -0,0 +1,70 @@
+#include "wl/misc/roundtripestimator.h"
+
+#include <algorithm>
+
+
+namespace wl {
+
+void RoundTripEstimator::addSample(const Clock::duration& sample)
+{
+    const auto nonNegativeSample = std::max(sample, Clock::duration::zero());
+
+    if (!m_hasSamples)
+    {
+        m_smoothedRoundTripTime = nonNegativeSample;
+        m_roundTripTimeDeviation = nonNegativeSample / 2;
+        m_hasSamples = true;
+    }
+    else
+    {
+        const auto error = nonNegativeSample - m_smoothedRoundTripTime;
+        const auto absoluteError = error < Clock::duration::zero() ? -error : error;
+
+        m_smoothedRoundTripTime += error / 8;
+        m_roundTripTimeDeviation += (absoluteError - m_roundTripTimeDeviation) / 4;
+    }
+
+    m_backoffShift = 0;
+}
+
+void RoundTripEstimator::addTimeout(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout)
+{
+    // the shift stops growing once the timeout reaches the maximum
+    if (getTimeout(minimumTimeout, maximumTimeout) < maximumTimeout && m_backoffShift < MAX_BACKOFF_SHIFT)
+    {
+        ++m_backoffShift;
+    }
+}
+
+bool RoundTripEstimator::hasSamples() const
+{
+    return m_hasSamples;
+}
+
+Clock::duration RoundTripEstimator::getTimeout(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout) const
+{
+    if (!m_hasSamples)
+    {
+        return maximumTimeout;
+    }
+
+    // the backoff applies to the limited timeout, otherwise the first doublings of a short estimate stay below the minimum
+    auto timeout = std::clamp(m_smoothedRoundTripTime + 4 * m_roundTripTimeDeviation, minimumTimeout, maximumTimeout);
+    for (uint8_t i = 0; i < m_backoffShift && timeout < maximumTimeout; ++i)
+    {
+        timeout *= 2;
+    }
+    return std::min(timeout, maximumTimeout);
+}
+
+Clock::duration RoundTripEstimator::getSmoothedRoundTripTime() const
+{
+    return m_smoothedRoundTripTime;
+}
+
+void RoundTripEstimator::reset()
+{
+    *this = RoundTripEstimator();
+}
+
+} // namespace wl
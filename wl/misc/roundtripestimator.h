@@ -0,0 +1,73 @@
+#ifndef WL_ROUNDTRIPESTIMATOR_H
+#define WL_ROUNDTRIPESTIMATOR_H
+
+#include "wl/time.h"
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @class RoundTripEstimator
+ * @headerfile roundtripestimator.h "wl/misc/roundtripestimator.h"
+ * @brief Running estimate of the device turnaround time used to derive response timeouts.
+ *
+ * @details
+ * Keeps smoothed round trip time and its mean deviation (Jacobson/Karels, as used by TCP). The timeout is
+ * the smoothed time plus four deviations, kept within the configured limits. Each timeout doubles it up to the
+ * maximum until the next successful sample (RFC 6298), so a device that is slow for a while is still waited for.
+ */
+class RoundTripEstimator
+{
+public:
+    /**
+     * @brief Adds a measured turnaround time of a successful request.
+     * @param sample Time between sending the request and receiving the response, without time spent on the wire.
+     */
+    void addSample(const Clock::duration& sample);
+
+    /**
+     * @brief Notes that a request timed out, doubling the timeout unless it already reached the maximum.
+     * @param minimumTimeout Lower limit of the timeout.
+     * @param maximumTimeout Upper limit of the timeout.
+     */
+    void addTimeout(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout);
+
+    /**
+     * @brief Checks if at least one sample was added.
+     * @return True if the estimate is based on a measurement, false otherwise.
+     */
+    bool hasSamples() const;
+
+    /**
+     * @brief Retrieves the timeout for the device turnaround.
+     * @param minimumTimeout Lower limit of the timeout.
+     * @param maximumTimeout Upper limit of the timeout, returned while there are no samples.
+     * @return Smoothed round trip time plus four mean deviations limited to [minimumTimeout, maximumTimeout],
+     * doubled for each timeout since the last sample up to maximumTimeout.
+     */
+    Clock::duration getTimeout(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout) const;
+
+    /**
+     * @brief Retrieves the smoothed round trip time.
+     * @return Smoothed round trip time, zero while there are no samples.
+     */
+    Clock::duration getSmoothedRoundTripTime() const;
+
+    /**
+     * @brief Discards all samples.
+     */
+    void reset();
+
+private:
+    static constexpr uint8_t MAX_BACKOFF_SHIFT = 16; // only bounds the counter for a zero timeout, the maximum timeout limits the backoff
+
+    Clock::duration m_smoothedRoundTripTime {0};
+    Clock::duration m_roundTripTimeDeviation {0};
+    bool m_hasSamples {false};
+    uint8_t m_backoffShift {0};
+};
+
+} // namespace wl
+
+#endif // WL_ROUNDTRIPESTIMATOR_H
@@ -0,0 +1,113 @@
+#include "wl/misc/statistics.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+
+namespace wl {
+
+void ErrorCounts::add(Error error)
+{
+    ++m_counts.at(static_cast<size_t>(error.get_value()));
+}
+
+uint32_t ErrorCounts::get(Error error) const
+{
+    return m_counts.at(static_cast<size_t>(error.get_value()));
+}
+
+uint32_t ErrorCounts::getTotal() const
+{
+    return std::accumulate(m_counts.begin(), m_counts.end(), uint32_t(0));
+}
+
+ErrorCounts& ErrorCounts::operator+=(const ErrorCounts& other)
+{
+    for (size_t i = 0; i < m_counts.size(); ++i)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+    return *this;
+}
+
+void LatencyHistogram::add(const Clock::duration& latency)
+{
+    const auto nonNegativeLatency = std::max(latency, Clock::duration::zero());
+
+    size_t bucket = 0;
+    while (bucket + 1 < BUCKETS_COUNT && nonNegativeLatency >= getBucketLimit(bucket))
+    {
+        ++bucket;
+    }
+
+    ++m_buckets[bucket];
+    ++m_count;
+    m_total += nonNegativeLatency;
+    m_maximum = std::max(m_maximum, nonNegativeLatency);
+}
+
+uint32_t LatencyHistogram::getCount() const
+{
+    return m_count;
+}
+
+uint32_t LatencyHistogram::getBucketCount(size_t bucket) const
+{
+    return m_buckets.at(bucket);
+}
+
+Clock::duration LatencyHistogram::getBucketLimit(size_t bucket)
+{
+    assert(bucket < BUCKETS_COUNT);
+    return bucket + 1 < BUCKETS_COUNT ? FIRST_BUCKET_LIMIT * (1 << bucket) : Clock::duration::max();
+}
+
+Clock::duration LatencyHistogram::getTotal() const
+{
+    return m_total;
+}
+
+Clock::duration LatencyHistogram::getMean() const
+{
+    return m_count > 0 ? m_total / m_count : Clock::duration::zero();
+}
+
+Clock::duration LatencyHistogram::getMaximum() const
+{
+    return m_maximum;
+}
+
+Clock::duration LatencyHistogram::getPercentile(uint8_t percent) const
+{
+    if (m_count == 0)
+    {
+        return Clock::duration::zero();
+    }
+
+    const uint64_t rank = std::max<uint64_t>(1, (uint64_t(m_count) * std::min<uint8_t>(percent, 100) + 99) / 100);
+    uint64_t count = 0;
+    for (size_t bucket = 0; bucket < BUCKETS_COUNT; ++bucket)
+    {
+        count += m_buckets[bucket];
+        if (count >= rank)
+        {
+            return std::min(getBucketLimit(bucket), m_maximum);
+        }
+    }
+    return m_maximum;
+}
+
+LatencyHistogram& LatencyHistogram::operator+=(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < m_buckets.size(); ++i)
+    {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+    m_total += other.m_total;
+    m_maximum = std::max(m_maximum, other.m_maximum);
+    return *this;
+}
+
+} // namespace wl
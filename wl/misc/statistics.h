@@ -0,0 +1,148 @@
+#ifndef WL_STATISTICS_H
+#define WL_STATISTICS_H
+
+#include "wl/error.h"
+#include "wl/time.h"
+
+#include <etl/array.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @brief Tells whether the library was built to collect communication statistics.
+ *
+ * Statistics are collected only when `WL_ENABLE_STATISTICS` is defined (CMake option `WEOMLINK_ENABLE_STATISTICS`),
+ * otherwise the counting compiles to nothing and all statistics stay zero.
+ */
+#ifdef WL_ENABLE_STATISTICS
+inline constexpr bool STATISTICS_ENABLED = true;
+#else
+inline constexpr bool STATISTICS_ENABLED = false;
+#endif
+
+/**
+ * @class ErrorCounts
+ * @headerfile statistics.h "wl/misc/statistics.h"
+ * @brief Number of occurrences of each error code.
+ */
+class ErrorCounts
+{
+public:
+    static constexpr size_t ERRORS_COUNT = Error::DATALINK__UNSUPPORTED_BAUDRATE + 1; ///< Number of error codes, the last code is the latest one added.
+
+    /**
+     * @brief Counts an occurrence of the error.
+     * @param error The error.
+     */
+    void add(Error error);
+
+    /**
+     * @brief Retrieves the number of occurrences of the error.
+     * @param error The error.
+     * @return Number of occurrences.
+     */
+    uint32_t get(Error error) const;
+
+    /**
+     * @brief Retrieves the number of occurrences of all errors.
+     * @return Sum of all counts.
+     */
+    uint32_t getTotal() const;
+
+    /**
+     * @brief Adds counts of another instance.
+     * @param other Counts to add.
+     * @return Reference to this instance.
+     */
+    ErrorCounts& operator+=(const ErrorCounts& other);
+
+private:
+    etl::array<uint32_t, ERRORS_COUNT> m_counts {};
+};
+
+/**
+ * @class LatencyHistogram
+ * @headerfile statistics.h "wl/misc/statistics.h"
+ * @brief Histogram of durations with fixed exponential buckets.
+ *
+ * @details
+ * Bucket 0 counts durations shorter than FIRST_BUCKET_LIMIT, each following bucket doubles the limit
+ * (100 us, 200 us, ... 1.6 s), the last bucket counts everything longer. No memory is allocated.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr size_t BUCKETS_COUNT = 16; ///< Number of buckets.
+    static constexpr Clock::duration FIRST_BUCKET_LIMIT = std::chrono::microseconds(100); ///< Upper limit of the first bucket.
+
+    /**
+     * @brief Adds a measured duration.
+     * @param latency The duration.
+     */
+    void add(const Clock::duration& latency);
+
+    /**
+     * @brief Retrieves the number of added durations.
+     * @return Number of samples.
+     */
+    uint32_t getCount() const;
+
+    /**
+     * @brief Retrieves the number of durations in a bucket.
+     * @param bucket Bucket index, lower than BUCKETS_COUNT.
+     * @return Number of samples in the bucket.
+     */
+    uint32_t getBucketCount(size_t bucket) const;
+
+    /**
+     * @brief Retrieves the exclusive upper limit of a bucket.
+     * @param bucket Bucket index, lower than BUCKETS_COUNT.
+     * @return Upper limit, Clock::duration::max() for the last bucket.
+     */
+    static Clock::duration getBucketLimit(size_t bucket);
+
+    /**
+     * @brief Retrieves the sum of all added durations.
+     * @return Total duration.
+     */
+    Clock::duration getTotal() const;
+
+    /**
+     * @brief Retrieves the mean of added durations.
+     * @return Mean duration, zero without samples.
+     */
+    Clock::duration getMean() const;
+
+    /**
+     * @brief Retrieves the longest added duration.
+     * @return Maximum duration, zero without samples.
+     */
+    Clock::duration getMaximum() const;
+
+    /**
+     * @brief Estimates a percentile from the buckets.
+     * @param percent Percentile (0 - 100).
+     * @return Upper limit of the bucket containing the percentile, at most the maximum, zero without samples.
+     */
+    Clock::duration getPercentile(uint8_t percent) const;
+
+    /**
+     * @brief Adds samples of another histogram.
+     * @param other Histogram to add.
+     * @return Reference to this instance.
+     */
+    LatencyHistogram& operator+=(const LatencyHistogram& other);
+
+private:
+    etl::array<uint32_t, BUCKETS_COUNT> m_buckets {};
+    uint32_t m_count {0};
+    Clock::duration m_total {0};
+    Clock::duration m_maximum {0};
+};
+
+} // namespace wl
+
+#endif // WL_STATISTICS_H
@@ -0,0 +1,119 @@
+#include "wl/misc/tracer.h"
+
+#include <algorithm>
+#include <cstdio>
+
+
+namespace wl {
+
+Tracer::Tracer(ITraceSink& sink, uint32_t trackId) :
+    m_sink(sink),
+    m_trackId(trackId),
+    m_startTime(Clock::now())
+{
+    m_sink.write("[");
+}
+
+Tracer::~Tracer()
+{
+    finish();
+}
+
+void Tracer::begin(const char* name, const TraceArguments& arguments)
+{
+    writeEvent('B', name, arguments);
+}
+
+void Tracer::end(const TraceArguments& arguments)
+{
+    writeEvent('E', nullptr, arguments);
+}
+
+void Tracer::instant(const char* name, const TraceArguments& arguments)
+{
+    writeEvent('i', name, arguments);
+}
+
+void Tracer::finish()
+{
+    if (!m_finished)
+    {
+        m_sink.write("\n]\n");
+        m_finished = true;
+    }
+}
+
+void Tracer::writeEvent(char phase, const char* name, const TraceArguments& arguments)
+{
+    if (m_finished)
+    {
+        return;
+    }
+
+    const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_startTime).count();
+
+    char buffer[EVENT_BUFFER_SIZE];
+    size_t length = 0;
+    const auto append = [&buffer, &length](int written)
+    {
+        length = std::min(length + std::max(written, 0), sizeof(buffer) - 1);
+    };
+
+    // the separator precedes the event, so the trace stays valid up to the last written event
+    append(snprintf(buffer + length, sizeof(buffer) - length, "%s\n{\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%lu",
+                    m_firstEvent ? "" : ",", phase, static_cast<long long>(timestamp), static_cast<unsigned long>(m_trackId)));
+    if (name)
+    {
+        append(snprintf(buffer + length, sizeof(buffer) - length, ",\"name\":\"%s\"", name));
+    }
+    if (phase == 'i')
+    {
+        append(snprintf(buffer + length, sizeof(buffer) - length, ",\"s\":\"t\""));
+    }
+
+    const char* separator = ",\"args\":{";
+    if (arguments.address.has_value())
+    {
+        append(snprintf(buffer + length, sizeof(buffer) - length, "%s\"address\":\"0x%08lX\"", separator, static_cast<unsigned long>(arguments.address.value())));
+        separator = ",";
+    }
+    if (arguments.size.has_value())
+    {
+        append(snprintf(buffer + length, sizeof(buffer) - length, "%s\"size\":%lu", separator, static_cast<unsigned long>(arguments.size.value())));
+        separator = ",";
+    }
+    if (arguments.packetId.has_value())
+    {
+        append(snprintf(buffer + length, sizeof(buffer) - length, "%s\"packetId\":%u", separator, static_cast<unsigned>(arguments.packetId.value())));
+        separator = ",";
+    }
+    if (arguments.error.has_value())
+    {
+        append(snprintf(buffer + length, sizeof(buffer) - length, "%s\"error\":\"%s\"", separator, arguments.error.value().c_str()));
+        separator = ",";
+    }
+    append(snprintf(buffer + length, sizeof(buffer) - length, "%s}", arguments.address.has_value() || arguments.size.has_value() ||
+                                                                         arguments.packetId.has_value() || arguments.error.has_value() ? "}" : ""));
+
+    m_sink.write(etl::string_view(buffer, length));
+    m_firstEvent = false;
+}
+
+TraceSpan::TraceSpan(Tracer* tracer, const char* name, const TraceArguments& arguments) :
+    m_tracer(tracer)
+{
+    if (m_tracer)
+    {
+        m_tracer->begin(name, arguments);
+    }
+}
+
+TraceSpan::~TraceSpan()
+{
+    if (m_tracer)
+    {
+        m_tracer->end(m_endArguments);
+    }
+}
+
+} // namespace wl
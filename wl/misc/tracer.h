@@ -0,0 +1,173 @@
+#ifndef WL_TRACER_H
+#define WL_TRACER_H
+
+#include "wl/error.h"
+#include "wl/time.h"
+
+#include <etl/expected.h>
+#include <etl/optional.h>
+#include <etl/string_view.h>
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @class ITraceSink
+ * @headerfile tracer.h "wl/misc/tracer.h"
+ * @brief Destination of the trace events formatted by Tracer, e.g. a file or a debug UART.
+ */
+class ITraceSink
+{
+public:
+    virtual ~ITraceSink() {}
+
+    /**
+     * @brief Writes a part of the trace.
+     * @param text Text to append, not null terminated. It is valid only during the call.
+     */
+    virtual void write(etl::string_view text) = 0;
+};
+
+/**
+ * @struct TraceArguments
+ * @headerfile tracer.h "wl/misc/tracer.h"
+ * @brief Arguments shown with a trace event, unset ones are omitted.
+ */
+struct TraceArguments
+{
+    etl::optional<uint32_t> address {};  ///< Device address.
+    etl::optional<uint32_t> size {};     ///< Data size in bytes.
+    etl::optional<uint8_t> packetId {};  ///< TCSI packet ID.
+    etl::optional<Error> error {};       ///< Error of the operation.
+};
+
+/**
+ * @class Tracer
+ * @headerfile tracer.h "wl/misc/tracer.h"
+ * @brief Writes Chrome trace-event JSON of WEOMlink operations, viewable in Perfetto or chrome://tracing.
+ *
+ * @details
+ * Events are written to the sink as they happen (JSON array format - one event per line), so the trace of a frozen
+ * application shows the operation that is still running. Spans are begin/end events, nested spans make a call stack.
+ * Each event is formatted into a fixed buffer, no memory is allocated. The tracer is not thread safe, use one tracer
+ * per thread - the track ID tells them apart.
+ *
+ * Spans are emitted only when the library is built with `WL_ENABLE_TRACING` (CMake option `WEOMLINK_ENABLE_TRACING`),
+ * otherwise the instrumentation compiles to nothing.
+ */
+class Tracer
+{
+public:
+    /**
+     * @brief Constructs the tracer and writes the beginning of the trace.
+     * @param sink Destination of the trace, has to outlive the tracer.
+     * @param trackId Thread ID of the events, tells apart traces of several devices or threads merged into one file.
+     */
+    explicit Tracer(ITraceSink& sink, uint32_t trackId = 1);
+
+    /**
+     * @brief Finishes the trace, see finish().
+     */
+    ~Tracer();
+
+    /**
+     * @brief Begins a span.
+     * @param name Name of the span, has to be a string literal or another string living as long as the tracer.
+     * @param arguments Arguments known at the beginning.
+     */
+    void begin(const char* name, const TraceArguments& arguments = {});
+
+    /**
+     * @brief Ends the innermost span.
+     * @param arguments Arguments known at the end (e.g. the error), merged with those of the beginning.
+     */
+    void end(const TraceArguments& arguments = {});
+
+    /**
+     * @brief Writes an event without duration.
+     * @param name Name of the event.
+     * @param arguments Arguments of the event.
+     */
+    void instant(const char* name, const TraceArguments& arguments = {});
+
+    /**
+     * @brief Writes the end of the trace, no events are written after.
+     *
+     * Perfetto and chrome://tracing also read traces without the end, e.g. of an application that was killed.
+     */
+    void finish();
+
+private:
+    void writeEvent(char phase, const char* name, const TraceArguments& arguments);
+
+    static constexpr size_t EVENT_BUFFER_SIZE = 256;
+
+    ITraceSink& m_sink;
+    uint32_t m_trackId;
+    Clock::time_point m_startTime;
+    bool m_firstEvent {true};
+    bool m_finished {false};
+};
+
+/**
+ * @class TraceSpan
+ * @headerfile tracer.h "wl/misc/tracer.h"
+ * @brief Span lasting until the end of the scope, used through the WL_TRACE_SPAN macro.
+ */
+class TraceSpan
+{
+public:
+    /**
+     * @brief Begins the span.
+     * @param tracer The tracer, nullptr if tracing is off.
+     * @param name Name of the span.
+     * @param arguments Arguments known at the beginning.
+     */
+    TraceSpan(Tracer* tracer, const char* name, const TraceArguments& arguments = {});
+
+    /**
+     * @brief Ends the span.
+     */
+    ~TraceSpan();
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    /**
+     * @brief Stores the error of the operation to the end of the span.
+     * @param result Result of the operation, nothing is stored on success.
+     */
+    template <typename T>
+    void setResult(const etl::expected<T, Error>& result);
+
+private:
+    Tracer* m_tracer;
+    TraceArguments m_endArguments;
+};
+
+template <typename T>
+void TraceSpan::setResult(const etl::expected<T, Error>& result)
+{
+    if (!result.has_value())
+    {
+        m_endArguments.error = result.error();
+    }
+}
+
+} // namespace wl
+
+#ifdef WL_ENABLE_TRACING
+/// Begins a span lasting until the end of the scope, the arguments are designated initializers of wl::TraceArguments.
+#define WL_TRACE_SPAN(tracer, name, ...) ::wl::TraceSpan wlTraceSpan((tracer), (name), ::wl::TraceArguments {__VA_ARGS__})
+/// Stores the error of an etl::expected result to the span of the scope.
+#define WL_TRACE_SPAN_RESULT(result) wlTraceSpan.setResult(result)
+/// Writes an event without duration, the arguments are designated initializers of wl::TraceArguments.
+#define WL_TRACE_INSTANT(tracer, name, ...) do { if (tracer) { (tracer)->instant((name), ::wl::TraceArguments {__VA_ARGS__}); } } while (false)
+#else
+#define WL_TRACE_SPAN(tracer, name, ...)
+#define WL_TRACE_SPAN_RESULT(result)
+#define WL_TRACE_INSTANT(tracer, name, ...)
+#endif
+
+#endif // WL_TRACER_H
@@ -1,4 +1,7 @@
 #include "wl/weom.h"
+#include "wl/misc/logger.h"
+
+#include <etl/algorithm.h>
 
 #include <cassert>
 
@@ -42,6 +45,31 @@ etl::expected<uint16_t, Error> doubleToFixedPoint(double value, const uint16_t f
     return valueFixed;
 }
 
+// the fastest first
+constexpr etl::array<Baudrate::enum_type, 3> BAUDRATES = {Baudrate::B_3000000, Baudrate::B_921600, Baudrate::B_115200};
+
+etl::optional<Baudrate> toBaudrate(uint32_t bitsPerSecond)
+{
+    for (const auto baudrate : BAUDRATES)
+    {
+        if (Baudrate::getBitsPerSecond(baudrate) == bitsPerSecond)
+        {
+            return Baudrate(baudrate);
+        }
+    }
+    return etl::nullopt;
+}
+
+bool isWeomIdentificator(etl::span<const uint8_t> identificator)
+{
+    static constexpr uint8_t WEOM_IDENTIFICATOR_BYTE_0 = 0x57;
+    static constexpr uint8_t WEOM_IDENTIFICATOR_BYTE_1 = 0x06;
+    static constexpr uint8_t WEOM_IDENTIFICATOR_BYTE_2 = 0x4D;
+    return (identificator[0] == WEOM_IDENTIFICATOR_BYTE_0)
+        && (identificator[1] == WEOM_IDENTIFICATOR_BYTE_1)
+        && (identificator[2] == WEOM_IDENTIFICATOR_BYTE_2);
+}
+
 } // namespace
 
 WEOM::WEOM(SleepFunction sleepFunction)
@@ -58,40 +86,596 @@ WEOM::~WEOM()
 
 etl::expected<void, Error> WEOM::setDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     m_lastPacketId = 0;
+    m_registerCache.clear();
+#ifdef WL_ENABLE_STATISTICS
+    m_previousLinksStatistics = getStatistics();
+#endif
     auto protocolInterface = etl::unique_ptr<ProtocolInterfaceTCSI>(new ProtocolInterfaceTCSI(m_sleepFunction));
     protocolInterface->setDataLinkInterface(etl::move(dataLinkInterface));
     m_deviceInterface = etl::unique_ptr<DeviceInterfaceWEOM>(new DeviceInterfaceWEOM(etl::move(protocolInterface), m_sleepFunction));
+    m_deviceInterface->setPipelineDepth(m_pipelineDepth);
+    m_deviceInterface->setTimeoutLimits(m_minimumTimeout, m_maximumTimeout);
+#ifdef WL_ENABLE_TRACING
+    m_deviceInterface->setTracer(m_tracer);
+#endif
 
-    auto result = readAddressRange<MemorySpaceWEOM::DEVICE_IDENTIFICATOR>();
-    if (!result.has_value())
+    if (m_baudrateAutodetection)
+    {
+        // the probes read the identificator too
+        if (const auto result = detectBaudrate(); !result.has_value())
+        {
+            return etl::unexpected<Error>(result.error());
+        }
+    }
+    else if (const auto result = checkDeviceIdentificator(); !result.has_value())
+    {
+        return result;
+    }
+    else if (const auto baudrate = toBaudrate(m_deviceInterface->getProtocolInterface()->getBaudrate()); baudrate.has_value())
+    {
+        m_lastKnownBaudrate = baudrate;
+    }
+
+    if (m_automaticBaudrateUpgrade)
+    {
+        // the connection stays at the current speed if the upgrade is not possible
+        if (const auto result = upgradeBaudrate(); !result.has_value() && result.error() != Error::DATALINK__UNSUPPORTED_BAUDRATE)
+        {
+            return etl::unexpected<Error>(result.error());
+        }
+    }
+    return {};
+}
+
+void WEOM::setPipelineDepth(uint8_t depth)
+{
+    m_pipelineDepth = depth;
+    if (m_deviceInterface)
+    {
+        m_deviceInterface->setPipelineDepth(depth);
+    }
+}
+
+uint8_t WEOM::getPipelineDepth() const
+{
+    return m_deviceInterface ? m_deviceInterface->getPipelineDepth() : m_pipelineDepth;
+}
+
+void WEOM::setTimeoutLimits(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout)
+{
+    m_minimumTimeout = minimumTimeout;
+    m_maximumTimeout = maximumTimeout;
+    if (m_deviceInterface)
+    {
+        m_deviceInterface->setTimeoutLimits(minimumTimeout, maximumTimeout);
+    }
+}
+
+void WEOM::setAutomaticBaudrateUpgrade(bool enabled)
+{
+    m_automaticBaudrateUpgrade = enabled;
+}
+
+etl::expected<Baudrate, Error> WEOM::upgradeBaudrate()
+{
+    WL_TRACE_SPAN(m_tracer, __func__);
+
+    if (!m_deviceInterface || !m_deviceInterface->getProtocolInterface())
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    const uint32_t currentBitsPerSecond = m_deviceInterface->getProtocolInterface()->getBaudrate();
+    const auto currentBaudrate = etl::find_if(BAUDRATES.begin(), BAUDRATES.end(), [currentBitsPerSecond](Baudrate baudrate)
+    {
+        return Baudrate::getBitsPerSecond(baudrate) == currentBitsPerSecond;
+    });
+    if (currentBaudrate == BAUDRATES.end())
+    {
+        return etl::unexpected<Error>(Error::DATALINK__UNSUPPORTED_BAUDRATE);
+    }
+
+    for (auto baudrate = BAUDRATES.begin(); baudrate != currentBaudrate; ++baudrate)
+    {
+        const uint32_t bitsPerSecond = Baudrate::getBitsPerSecond(*baudrate);
+        if (!m_deviceInterface->isBaudrateSupported(bitsPerSecond))
+        {
+            continue;
+        }
+
+        // the device may switch before its response is sent, so a single short attempt is made (a retry would go out at the old speed)
+        // and the identificator read at the new speed tells
+        etl::array<uint8_t, MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getSize()> data = {};
+        data.at(0) = static_cast<uint8_t>(*baudrate);
+        m_registerCache.invalidate(MemorySpaceWEOM::UART_BAUDRATE_CURRENT);
+        const auto writeResult = m_deviceInterface->probeWrite(data, MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getFirstAddress(), m_minimumTimeout);
+        auto switchResult = m_deviceInterface->setBaudrate(bitsPerSecond);
+        if (switchResult.has_value())
+        {
+            switchResult = checkDeviceIdentificator();
+            if (switchResult.has_value())
+            {
+                WL_LOG(LogLevel::INFO, "Baud rate upgraded");
+                m_lastKnownBaudrate = *baudrate;
+                return *baudrate;
+            }
+        }
+
+        WL_LOG(LogLevel::WARNING, "Baud rate switch not verified, reverting", .error = switchResult.error());
+        if (const auto revertResult = m_deviceInterface->setBaudrate(currentBitsPerSecond); !revertResult.has_value())
+        {
+            return etl::unexpected<Error>(revertResult.error());
+        }
+        if (const auto checkResult = checkDeviceIdentificator(); !checkResult.has_value())
+        {
+            WL_LOG(LogLevel::FAILURE, "Device does not respond at the previous baud rate", .error = checkResult.error());
+            return etl::unexpected<Error>(checkResult.error());
+        }
+        if (writeResult.has_value())
+        {
+            // the device accepted the value but still talks at the previous speed, keep the register consistent
+            (void)setUartBaudrate(*currentBaudrate, MemoryTypeWEOM::REGISTERS_CONFIGURATION);
+        }
+    }
+    return *currentBaudrate;
+}
+
+void WEOM::setBaudrateAutodetection(bool enabled)
+{
+    m_baudrateAutodetection = enabled;
+}
+
+etl::expected<Baudrate, Error> WEOM::detectBaudrate()
+{
+    WL_TRACE_SPAN(m_tracer, __func__);
+
+    if (!m_deviceInterface || !m_deviceInterface->getProtocolInterface())
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    const uint32_t initialBitsPerSecond = m_deviceInterface->getProtocolInterface()->getBaudrate();
+    etl::vector<Baudrate, BAUDRATES.size() + 2> candidates;
+    const auto addCandidate = [&candidates](const etl::optional<Baudrate>& baudrate)
+    {
+        if (baudrate.has_value() && etl::find(candidates.begin(), candidates.end(), baudrate.value()) == candidates.end())
+        {
+            candidates.push_back(baudrate.value());
+        }
+    };
+    addCandidate(m_lastKnownBaudrate);
+    addCandidate(toBaudrate(initialBitsPerSecond));
+    // the power-on default first
+    for (auto baudrate = BAUDRATES.rbegin(); baudrate != BAUDRATES.rend(); ++baudrate)
+    {
+        addCandidate(Baudrate(*baudrate));
+    }
+
+    etl::expected<void, Error> result = etl::unexpected<Error>(Error::DATALINK__UNSUPPORTED_BAUDRATE);
+    uint32_t currentBitsPerSecond = initialBitsPerSecond;
+    for (const auto& baudrate : candidates)
+    {
+        const uint32_t bitsPerSecond = Baudrate::getBitsPerSecond(baudrate);
+        if (bitsPerSecond != currentBitsPerSecond)
+        {
+            if (!m_deviceInterface->isBaudrateSupported(bitsPerSecond) || !m_deviceInterface->setBaudrate(bitsPerSecond).has_value())
+            {
+                continue;
+            }
+            currentBitsPerSecond = bitsPerSecond;
+        }
+
+        etl::array<uint8_t, MemorySpaceWEOM::DEVICE_IDENTIFICATOR.getSize()> identificator = {};
+        result = m_deviceInterface->probeData(identificator, MemorySpaceWEOM::DEVICE_IDENTIFICATOR.getFirstAddress(), m_minimumTimeout);
+        if (result.has_value() && !isWeomIdentificator(identificator))
+        {
+            result = etl::unexpected<Error>(Error::DEVICE__NO_PROTOCOL);
+        }
+        if (result.has_value())
+        {
+            m_lastKnownBaudrate = baudrate;
+            return baudrate;
+        }
+    }
+
+    if (currentBitsPerSecond != initialBitsPerSecond)
+    {
+        (void)m_deviceInterface->setBaudrate(initialBitsPerSecond);
+    }
+    WL_LOG(LogLevel::FAILURE, "Device does not respond at any baud rate", .error = result.error());
+    return etl::unexpected<Error>(result.error());
+}
+
+void WEOM::setLastKnownBaudrate(Baudrate baudrate)
+{
+    m_lastKnownBaudrate = baudrate;
+}
+
+etl::optional<Baudrate> WEOM::getLastKnownBaudrate() const
+{
+    return m_lastKnownBaudrate;
+}
+
+void WEOM::setTracer(Tracer* tracer)
+{
+#ifdef WL_ENABLE_TRACING
+    m_tracer = tracer;
+    if (m_deviceInterface)
+    {
+        m_deviceInterface->setTracer(tracer);
+    }
+#else
+    (void)tracer;
+#endif
+}
+
+void WEOM::setRegisterCachePolicy(RegisterClassWEOM registerClass, RegisterCachePolicyWEOM policy)
+{
+    m_registerCache.setPolicy(registerClass, policy);
+}
+
+void WEOM::clearRegisterCache()
+{
+    m_registerCache.clear();
+}
+
+WEOM::Statistics WEOM::getStatistics() const
+{
+#ifdef WL_ENABLE_STATISTICS
+    Statistics statistics = m_previousLinksStatistics;
+    if (m_deviceInterface)
+    {
+        statistics.device += m_deviceInterface->getStatistics();
+        if (const auto* protocolInterface = m_deviceInterface->getProtocolInterface())
+        {
+            statistics.protocol += protocolInterface->getStatistics();
+        }
+    }
+    return statistics;
+#else
+    return {};
+#endif
+}
+
+void WEOM::resetStatistics()
+{
+#ifdef WL_ENABLE_STATISTICS
+    m_previousLinksStatistics = {};
+    if (m_deviceInterface)
+    {
+        m_deviceInterface->resetStatistics();
+    }
+#endif
+}
+
+etl::expected<ConfigurationSnapshot, Error> WEOM::readSnapshot()
+{
+    WL_TRACE_SPAN(m_tracer, __func__);
+
+    if (!m_deviceInterface)
+    {
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    // all registers of the register groups, nearby ones are read together by readMany
+    static constexpr AddressRange SNAPSHOT_REGISTERS[] = {
+        MemorySpaceWEOM::DEVICE_IDENTIFICATOR, MemorySpaceWEOM::TRIGGER, MemorySpaceWEOM::STATUS,
+
+        MemorySpaceWEOM::MAIN_FIRMWARE_VERSION, MemorySpaceWEOM::SHUTTER_TEMPERATURE, MemorySpaceWEOM::SERIAL_NUMBER_CURRENT,
+        MemorySpaceWEOM::ARTICLE_NUMBER_CURRENT, MemorySpaceWEOM::LED_R_BRIGHTNESS, MemorySpaceWEOM::LED_G_BRIGHTNESS,
+        MemorySpaceWEOM::LED_B_BRIGHTNESS, MemorySpaceWEOM::TRIGGER_MODE, MemorySpaceWEOM::AUX_PIN_0, MemorySpaceWEOM::AUX_PIN_1,
+        MemorySpaceWEOM::AUX_PIN_2,
+
+        MemorySpaceWEOM::PALETTE_INDEX_CURRENT, MemorySpaceWEOM::FRAME_RATE_CURRENT, MemorySpaceWEOM::IMAGE_FLIP_CURRENT,
+        MemorySpaceWEOM::IMAGE_FREEZE, MemorySpaceWEOM::VIDEO_FORMAT, MemorySpaceWEOM::TEST_PATTERN, MemorySpaceWEOM::RETICLE_TYPE,
+        MemorySpaceWEOM::RETICLE_POSITION_X, MemorySpaceWEOM::RETICLE_POSITION_Y,
+
+        MemorySpaceWEOM::SHUTTER_COUNTER, MemorySpaceWEOM::TIME_FROM_LAST_NUC_OFFSET_UPDATE, MemorySpaceWEOM::NUC_UPDATE_MODE_CURRENT,
+        MemorySpaceWEOM::INTERNAL_SHUTTER_POSITION, MemorySpaceWEOM::NUC_MAX_PERIOD_CURRENT, MemorySpaceWEOM::NUC_ADAPTIVE_THRESHOLD_CURRENT,
+
+        MemorySpaceWEOM::UART_BAUDRATE_CURRENT,
+
+        MemorySpaceWEOM::TIME_DOMAIN_AVERAGE_CURRENT, MemorySpaceWEOM::IMAGE_EQUALIZATION_TYPE_CURRENT, MemorySpaceWEOM::MGC_CONTRAST_BRIGHTNESS_CURRENT,
+        MemorySpaceWEOM::FRAME_BLOCK_MEDIAN_CONBRIGHT, MemorySpaceWEOM::AGC_NH_SMOOTHING_CURRENT, MemorySpaceWEOM::SPATIAL_MEDIAN_FILTER_ENABLE_CURRENT,
+        MemorySpaceWEOM::LINEAR_GAIN_WEIGHT, MemorySpaceWEOM::CLIP_LIMIT, MemorySpaceWEOM::PLATEAU_TAIL_REJECTION,
+        MemorySpaceWEOM::SMART_TIME_DOMAIN_AVERAGE_THRESHOLD, MemorySpaceWEOM::SMART_MEDIAN_THRESHOLD, MemorySpaceWEOM::GAMMA_CORRECTION,
+        MemorySpaceWEOM::MAX_AMPLIFICATION, MemorySpaceWEOM::DAMPING_FACTOR,
+
+        MemorySpaceWEOM::SELECTED_PRESET_INDEX, MemorySpaceWEOM::CURRENT_PRESET_INDEX, MemorySpaceWEOM::SELECTED_ATTRIBUTE_AND_PRESET_INDEX,
+        MemorySpaceWEOM::ATTRIBUTE_ADDRESS, MemorySpaceWEOM::NUMBER_OF_PRESETS_AND_ATTRIBUTES, MemorySpaceWEOM::SELECTED_PRESET_ID,
+        MemorySpaceWEOM::CURRENT_PRESET_ID,
+    };
+    static constexpr size_t SNAPSHOT_REGISTERS_COUNT = sizeof(SNAPSHOT_REGISTERS) / sizeof(SNAPSHOT_REGISTERS[0]);
+    static constexpr size_t SNAPSHOT_MAXIMUM_SIZE = []()
+    {
+        size_t size = 0;
+        for (const auto& addressRange : SNAPSHOT_REGISTERS)
+        {
+            size += addressRange.getSize();
+        }
+        return size;
+    }();
+
+    etl::array<uint8_t, SNAPSHOT_MAXIMUM_SIZE> data = {};
+    etl::vector<PrefetchedRange, SNAPSHOT_REGISTERS_COUNT> prefetchedRanges;
+    etl::vector<IDeviceInterface::ReadRequest, SNAPSHOT_REGISTERS_COUNT> requests;
+    etl::span<uint8_t> freeData = data;
+    for (const auto& addressRange : SNAPSHOT_REGISTERS)
+    {
+        const auto registerData = freeData.first(addressRange.getSize());
+        freeData = freeData.subspan(addressRange.getSize());
+        prefetchedRanges.push_back(PrefetchedRange{addressRange, registerData});
+        requests.push_back(IDeviceInterface::ReadRequest{registerData, addressRange.getFirstAddress()});
+    }
+
+    if (const auto result = m_deviceInterface->readMany(requests); !result.has_value())
     {
         return etl::unexpected<Error>(result.error());
     }
-    static constexpr uint8_t WEOM_IDENTIFICATOR_BYTE_0 = 0x57;
-    static constexpr uint8_t WEOM_IDENTIFICATOR_BYTE_1 = 0x06;
-    static constexpr uint8_t WEOM_IDENTIFICATOR_BYTE_2 = 0x4D;
-    if ((result.value().at(0) != WEOM_IDENTIFICATOR_BYTE_0)
-        || (result.value().at(1) != WEOM_IDENTIFICATOR_BYTE_1)
-        || (result.value().at(2) != WEOM_IDENTIFICATOR_BYTE_2))
+
+    // decode using the getters, their reads are served from the read data
+    m_prefetchedRanges = prefetchedRanges;
+
+    ConfigurationSnapshot snapshot;
+    etl::optional<Error> error;
+    const auto decode = [&error](auto& member, const auto& result)
+    {
+        if (result.has_value())
+        {
+            member = result.value();
+        }
+        else if (!error.has_value())
+        {
+            error = result.error();
+        }
+    };
+
+    decode(snapshot.status, getStatus());
+    decode(snapshot.triggers, getTriggers());
+
+    decode(snapshot.firmwareVersion, getFirmwareVersion());
+    decode(snapshot.shutterTemperature, getShutterTemperature());
+    decode(snapshot.serialNumber, getSerialNumber());
+    decode(snapshot.articleNumber, getArticleNumber());
+    decode(snapshot.ledRedBrightness, getLedRedBrightness());
+    decode(snapshot.ledGreenBrightness, getLedGreenBrightness());
+    decode(snapshot.ledBlueBrightness, getLedBlueBrightness());
+    decode(snapshot.triggerMode, getTriggerMode());
+    decode(snapshot.auxPin0, getAuxPin(0));
+    decode(snapshot.auxPin1, getAuxPin(1));
+    decode(snapshot.auxPin2, getAuxPin(2));
+
+    decode(snapshot.paletteIndex, getPaletteIndex());
+    decode(snapshot.framerate, getFramerate());
+    decode(snapshot.imageFlip, getImageFlip());
+    decode(snapshot.imageFreeze, getImageFreeze());
+    decode(snapshot.videoFormat, getVideoFormat());
+    decode(snapshot.imageGenerator, getImageGenerator());
+    decode(snapshot.reticleType, getReticleType());
+    decode(snapshot.reticlePositionX, getReticlePositionX());
+    decode(snapshot.reticlePositionY, getReticlePositionY());
+
+    decode(snapshot.shutterCounter, getShutterCounter());
+    decode(snapshot.timeFromLastNucOffsetUpdate, getTimeFromLastNucOffsetUpdate());
+    decode(snapshot.shutterUpdateMode, getShutterUpdateMode());
+    decode(snapshot.internalShutterPosition, getInternalShutterPosition());
+    decode(snapshot.shutterMaxPeriod, getShutterMaxPeriod());
+    decode(snapshot.shutterAdaptiveThreshold, getShutterAdaptiveThreshold());
+
+    decode(snapshot.uartBaudrate, getUartBaudrate());
+
+    decode(snapshot.timeDomainAveraging, getTimeDomainAveraging());
+    decode(snapshot.imageEqualizationType, getImageEqualizationType());
+    decode(snapshot.mgcContrastBrightness, getMgcContrastBrightness());
+    decode(snapshot.frameBlockMedianConbright, getFrameBlockMedianConbright());
+    decode(snapshot.agcNhSmoothingFrames, getAgcNhSmoothingFrames());
+    decode(snapshot.spatialMedianFilterEnabled, getSpatialMedianFilterEnabled());
+    decode(snapshot.linearGainWeight, getLinearGainWeight());
+    decode(snapshot.clipLimit, getClipLimit());
+    decode(snapshot.plateauTailRejection, getPlateauTailRejection());
+    decode(snapshot.smartTimeDomainAverageThreshold, getSmartTimeDomainAverageThreshold());
+    decode(snapshot.smartMedianThreshold, getSmartMedianThreshold());
+    decode(snapshot.gammaCorrection, getGammaCorrection());
+    decode(snapshot.maxAmplification, getMaxAmplification());
+    decode(snapshot.dampingFactor, getDampingFactor());
+
+    decode(snapshot.presetId, getPresetId());
+    decode(snapshot.presetIndex, getPresetIndex());
+    decode(snapshot.presetIdCount, getPresetIdCount());
+
+    m_prefetchedRanges = {};
+
+    if (error.has_value())
+    {
+        return etl::unexpected<Error>(error.value());
+    }
+    return snapshot;
+}
+
+etl::expected<void, Error> WEOM::apply(const ConfigurationSnapshot& target, MemoryTypeWEOM memoryType)
+{
+    WL_TRACE_SPAN(m_tracer, __func__);
+
+    if (!m_deviceInterface)
     {
-        return etl::unexpected<Error>(Error::DEVICE__NO_PROTOCOL);
+        return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
+    }
+
+    const uint32_t addressOffset = memoryType == MemoryTypeWEOM::FLASH_MEMORY ? MemorySpaceWEOM::ADDRESS_FLASH_REGISTERS_START : 0;
+
+    // selecting a preset reloads the other settings, so it has to be done before they are compared
+    if (memoryType == MemoryTypeWEOM::REGISTERS_CONFIGURATION)
+    {
+        const auto presetIndex = getPresetIndex();
+        if (!presetIndex.has_value())
+        {
+            return etl::unexpected<Error>(presetIndex.error());
+        }
+        if (presetIndex.value() != target.presetIndex)
+        {
+            if (const auto result = setPresetId(target.presetIndex); !result.has_value())
+            {
+                return etl::unexpected<Error>(result.error());
+            }
+        }
+    }
+    else
+    {
+        etl::array<uint8_t, MemorySpaceWEOM::SELECTED_PRESET_INDEX.getSize()> data = {};
+        if (const auto result = m_deviceInterface->readData(data, MemorySpaceWEOM::SELECTED_PRESET_INDEX.getFirstAddress() + addressOffset); !result.has_value())
+        {
+            return etl::unexpected<Error>(result.error());
+        }
+        if (data.at(0) != target.presetIndex)
+        {
+            data = {};
+            data.at(0) = target.presetIndex;
+            if (const auto result = writeData(data, MemorySpaceWEOM::SELECTED_PRESET_INDEX, memoryType); !result.has_value())
+            {
+                return etl::unexpected<Error>(result.error());
+            }
+        }
+    }
+
+    // encode the target by the setters, writeData only stages the registers
+    etl::vector<StagedWrite, STAGED_WRITES_CAPACITY> stagedWrites;
+    m_stagedWrites = &stagedWrites;
+
+    etl::optional<Error> error;
+    const auto stage = [&error](const etl::expected<void, Error>& result)
+    {
+        if (!result.has_value() && !error.has_value())
+        {
+            error = result.error();
+        }
+    };
+
+    stage(setLedRedBrightness(target.ledRedBrightness, memoryType));
+    stage(setLedGreenBrightness(target.ledGreenBrightness, memoryType));
+    stage(setLedBlueBrightness(target.ledBlueBrightness, memoryType));
+    stage(setTriggerMode(target.triggerMode, memoryType));
+    stage(setAuxPin(0, target.auxPin0, memoryType));
+    stage(setAuxPin(1, target.auxPin1, memoryType));
+    stage(setAuxPin(2, target.auxPin2, memoryType));
+
+    stage(setPaletteIndex(target.paletteIndex, memoryType));
+    stage(setVideoFormat(target.videoFormat, memoryType));
+    stage(setReticleType(target.reticleType, memoryType));
+    stage(setReticlePositionX(target.reticlePositionX, memoryType));
+    stage(setReticlePositionY(target.reticlePositionY, memoryType));
+
+    stage(setShutterUpdateMode(target.shutterUpdateMode, memoryType));
+    stage(setShutterMaxPeriod(target.shutterMaxPeriod, memoryType));
+    stage(setShutterAdaptiveThreshold(target.shutterAdaptiveThreshold, memoryType));
+
+    stage(setTimeDomainAveraging(target.timeDomainAveraging, memoryType));
+    stage(setImageEqualizationType(target.imageEqualizationType, memoryType));
+    stage(setMgcContrastBrightness(target.mgcContrastBrightness, memoryType));
+    stage(setAgcNhSmoothingFrames(target.agcNhSmoothingFrames, memoryType));
+    stage(setSpatialMedianFilterEnabled(target.spatialMedianFilterEnabled, memoryType));
+    stage(setLinearGainWeight(target.linearGainWeight, memoryType));
+    stage(setClipLimit(target.clipLimit, memoryType));
+    stage(setPlateauTailRejection(target.plateauTailRejection, memoryType));
+    stage(setSmartTimeDomainAverageThreshold(target.smartTimeDomainAverageThreshold, memoryType));
+    stage(setSmartMedianThreshold(target.smartMedianThreshold, memoryType));
+    stage(setGammaCorrection(target.gammaCorrection, memoryType));
+    stage(setMaxAmplification(target.maxAmplification, memoryType));
+    stage(setDampingFactor(target.dampingFactor, memoryType));
+
+    if (memoryType == MemoryTypeWEOM::REGISTERS_CONFIGURATION)
+    {
+        stage(setFramerate(target.framerate));
+        stage(setImageFlip(target.imageFlip));
+        stage(setImageFreeze(target.imageFreeze));
+        stage(setImageGenerator(target.imageGenerator));
+    }
+
+    m_stagedWrites = nullptr;
+
+    if (error.has_value())
+    {
+        return etl::unexpected<Error>(error.value());
+    }
+
+    etl::sort(stagedWrites.begin(), stagedWrites.end(), [](const StagedWrite& a, const StagedWrite& b)
+    {
+        return a.addressRange.getFirstAddress() < b.addressRange.getFirstAddress();
+    });
+    const auto isAdjacent = [&stagedWrites](size_t index)
+    {
+        return stagedWrites.at(index).addressRange.getFirstAddress() == stagedWrites.at(index - 1).addressRange.getLastAddress() + 1;
+    };
+
+    // registers are of the same size, register at index i occupies the buffer from i * REGISTER_SIZE
+    static constexpr uint32_t REGISTER_SIZE = MemorySpaceWEOM::REGISTERS_MINIMUM_DATA_SIZE;
+    etl::array<uint8_t, STAGED_WRITES_CAPACITY * REGISTER_SIZE> currentData = {};
+
+    // current content of registers not cached, nearby ones are read together
+    etl::vector<IDeviceInterface::ReadRequest, STAGED_WRITES_CAPACITY> requests;
+    for (size_t i = 0; i < stagedWrites.size(); ++i)
+    {
+        const auto registerData = etl::span<uint8_t>(currentData).subspan(i * REGISTER_SIZE, REGISTER_SIZE);
+        if (memoryType != MemoryTypeWEOM::REGISTERS_CONFIGURATION || !m_registerCache.read(stagedWrites.at(i).addressRange, registerData))
+        {
+            requests.push_back(IDeviceInterface::ReadRequest{registerData, stagedWrites.at(i).addressRange.getFirstAddress() + addressOffset});
+        }
+    }
+    if (const auto result = m_deviceInterface->readMany(requests); !result.has_value())
+    {
+        return etl::unexpected<Error>(result.error());
+    }
+
+    // changed registers, adjacent ones are written together
+    const auto isChanged = [&stagedWrites, &currentData](size_t index)
+    {
+        const auto& data = stagedWrites.at(index).data;
+        return !etl::equal(data.begin(), data.end(), currentData.begin() + index * REGISTER_SIZE);
+    };
+    for (size_t first = 0; first < stagedWrites.size();)
+    {
+        if (!isChanged(first))
+        {
+            ++first;
+            continue;
+        }
+
+        size_t last = first;
+        while (last + 1 < stagedWrites.size() && isAdjacent(last + 1) && isChanged(last + 1))
+        {
+            ++last;
+        }
+
+        const auto run = etl::span<const StagedWrite>(stagedWrites).subspan(first, last - first + 1);
+        if (const auto result = writeStagedWrites(run); !result.has_value())
+        {
+            return etl::unexpected<Error>(result.error());
+        }
+        first = last + 1;
     }
     return {};
 }
 
 etl::expected<Status, Error> WEOM::getStatus()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::STATUS>();
     if (!result.has_value())
     {
         return etl::unexpected<Error>(result.error());
     }
-    return Status(deserialize<uint32_t>(result.value()));
+    const Status status(deserialize<uint32_t>(result.value()));
+    m_registerCache.invalidate(status);
+    return status;
 }
 
 etl::expected<Triggers, Error> WEOM::getTriggers()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::TRIGGER>();
     if (!result.has_value())
     {
@@ -102,13 +686,20 @@ etl::expected<Triggers, Error> WEOM::getTriggers()
 
 etl::expected<void, Error> WEOM::activateTrigger(Trigger trigger)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::TRIGGER.getSize()> data = {};
     serialize(static_cast<uint32_t>(trigger), data.data(), data.size());
-    return writeData(data, MemorySpaceWEOM::TRIGGER);
+    auto result = writeData(data, MemorySpaceWEOM::TRIGGER);
+    // the trigger may have been executed even if its response got lost
+    m_registerCache.invalidate(trigger);
+    return result;
 }
 
 etl::expected<uint8_t, Error> WEOM::getLedRedBrightness()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::LED_R_BRIGHTNESS>();
     if (!result.has_value())
     {
@@ -119,6 +710,8 @@ etl::expected<uint8_t, Error> WEOM::getLedRedBrightness()
 
 etl::expected<void, Error> WEOM::setLedRedBrightness(uint8_t brightness, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::LED_R_BRIGHTNESS.getSize()> data = {};
     data.at(0) = brightness;
     return writeData(data, MemorySpaceWEOM::LED_R_BRIGHTNESS, memoryType);
@@ -126,6 +719,8 @@ etl::expected<void, Error> WEOM::setLedRedBrightness(uint8_t brightness, MemoryT
 
 etl::expected<uint8_t, Error> WEOM::getLedGreenBrightness()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::LED_G_BRIGHTNESS>();
     if (!result.has_value())
     {
@@ -136,6 +731,8 @@ etl::expected<uint8_t, Error> WEOM::getLedGreenBrightness()
 
 etl::expected<void, Error> WEOM::setLedGreenBrightness(uint8_t brightness, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::LED_G_BRIGHTNESS.getSize()> data = {};
     data.at(0) = brightness;
     return writeData(data, MemorySpaceWEOM::LED_G_BRIGHTNESS, memoryType);
@@ -143,6 +740,8 @@ etl::expected<void, Error> WEOM::setLedGreenBrightness(uint8_t brightness, Memor
 
 etl::expected<uint8_t, Error> WEOM::getLedBlueBrightness()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::LED_B_BRIGHTNESS>();
     if (!result.has_value())
     {
@@ -153,6 +752,8 @@ etl::expected<uint8_t, Error> WEOM::getLedBlueBrightness()
 
 etl::expected<void, Error> WEOM::setLedBlueBrightness(uint8_t brightness, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::LED_B_BRIGHTNESS.getSize()> data = {};
     data.at(0) = brightness;
     return writeData(data, MemorySpaceWEOM::LED_B_BRIGHTNESS, memoryType);
@@ -160,6 +761,8 @@ etl::expected<void, Error> WEOM::setLedBlueBrightness(uint8_t brightness, Memory
 
 etl::expected<etl::string<WEOM::SERIAL_NUMBER_STRING_SIZE>, Error> WEOM::getSerialNumber()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::SERIAL_NUMBER_CURRENT>();
     if (!result.has_value())
     {
@@ -170,6 +773,8 @@ etl::expected<etl::string<WEOM::SERIAL_NUMBER_STRING_SIZE>, Error> WEOM::getSeri
 
 etl::expected<etl::string<WEOM::ARTICLE_NUMBER_STRING_SIZE>, Error> WEOM::getArticleNumber()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::ARTICLE_NUMBER_CURRENT>();
     if (!result.has_value())
     {
@@ -180,6 +785,8 @@ etl::expected<etl::string<WEOM::ARTICLE_NUMBER_STRING_SIZE>, Error> WEOM::getArt
 
 etl::expected<FirmwareVersion, Error> WEOM::getFirmwareVersion()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::MAIN_FIRMWARE_VERSION>();
     if (!result.has_value())
     {
@@ -190,6 +797,8 @@ etl::expected<FirmwareVersion, Error> WEOM::getFirmwareVersion()
 
 etl::expected<uint8_t, Error> WEOM::getPaletteIndex()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::PALETTE_INDEX_CURRENT>();
     if (!result.has_value())
     {
@@ -200,6 +809,8 @@ etl::expected<uint8_t, Error> WEOM::getPaletteIndex()
 
 etl::expected<void, Error> WEOM::setPaletteIndex(uint8_t index, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::PALETTE_INDEX_CURRENT.getSize()> data = {};
     data.at(0) = index;
     return writeData(data, MemorySpaceWEOM::PALETTE_INDEX_CURRENT, memoryType);
@@ -207,6 +818,8 @@ etl::expected<void, Error> WEOM::setPaletteIndex(uint8_t index, MemoryTypeWEOM m
 
 etl::expected<etl::string<MemorySpaceWEOM::PALETTE_NAME_SIZE>, Error> WEOM::getPaletteName(unsigned paletteIndex)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     if (!m_deviceInterface)
     {
         return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
@@ -224,6 +837,8 @@ etl::expected<etl::string<MemorySpaceWEOM::PALETTE_NAME_SIZE>, Error> WEOM::getP
 
 etl::expected<TriggerMode, Error> WEOM::getTriggerMode()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::TRIGGER_MODE>();
     if (!result.has_value())
     {
@@ -234,6 +849,8 @@ etl::expected<TriggerMode, Error> WEOM::getTriggerMode()
 
 etl::expected<void, Error> WEOM::setTriggerMode(TriggerMode mode, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::TRIGGER_MODE.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(mode);
     return writeData(data, MemorySpaceWEOM::TRIGGER_MODE, memoryType);
@@ -241,6 +858,8 @@ etl::expected<void, Error> WEOM::setTriggerMode(TriggerMode mode, MemoryTypeWEOM
 
 etl::expected<AuxPin, Error> WEOM::getAuxPin(uint8_t pin)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     if (pin > 2)
     {
         return etl::unexpected<Error>(Error::DEVICE__INVALID_PIN);
@@ -271,6 +890,8 @@ etl::expected<AuxPin, Error> WEOM::getAuxPin(uint8_t pin)
 
 etl::expected<void, Error> WEOM::setAuxPin(uint8_t pin, AuxPin mode, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     if (pin > 2)
     {
         return etl::unexpected<Error>(Error::DEVICE__INVALID_PIN);
@@ -292,6 +913,8 @@ etl::expected<void, Error> WEOM::setAuxPin(uint8_t pin, AuxPin mode, MemoryTypeW
 
 etl::expected<Framerate, Error> WEOM::getFramerate()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::FRAME_RATE_CURRENT>();
     if (!result.has_value())
     {
@@ -302,6 +925,8 @@ etl::expected<Framerate, Error> WEOM::getFramerate()
 
 etl::expected<void, Error> WEOM::setFramerate(Framerate framerate)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::FRAME_RATE_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(framerate);
     return writeData(data, MemorySpaceWEOM::FRAME_RATE_CURRENT);
@@ -309,6 +934,8 @@ etl::expected<void, Error> WEOM::setFramerate(Framerate framerate)
 
 etl::expected<ImageFlip, Error> WEOM::getImageFlip()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::IMAGE_FLIP_CURRENT>();
     if (!result.has_value())
     {
@@ -319,6 +946,8 @@ etl::expected<ImageFlip, Error> WEOM::getImageFlip()
 
 etl::expected<void, Error> WEOM::setImageFlip(const ImageFlip& flip)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::IMAGE_FLIP_CURRENT.getSize()> data = {};
     if (flip.getVerticalFlip())
     {
@@ -333,7 +962,9 @@ etl::expected<void, Error> WEOM::setImageFlip(const ImageFlip& flip)
 
 etl::expected<bool, Error> WEOM::getImageFreeze()
 {
-    auto result = readAddressRange<MemorySpaceWEOM::STATUS>();
+    WL_TRACE_SPAN(m_tracer, __func__);
+
+    auto result = readAddressRange<MemorySpaceWEOM::IMAGE_FREEZE>();
     if (!result.has_value())
     {
         return etl::unexpected<Error>(result.error());
@@ -343,6 +974,8 @@ etl::expected<bool, Error> WEOM::getImageFreeze()
 
 etl::expected<void, Error> WEOM::setImageFreeze(bool freeze)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::IMAGE_FREEZE.getSize()> data = {};
     data.at(0) = freeze ? 1 : 0;
     return writeData(data, MemorySpaceWEOM::IMAGE_FREEZE);
@@ -350,6 +983,8 @@ etl::expected<void, Error> WEOM::setImageFreeze(bool freeze)
 
 etl::expected<ImageGenerator, Error> WEOM::getImageGenerator()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::TEST_PATTERN>();
     if (!result.has_value())
     {
@@ -360,6 +995,8 @@ etl::expected<ImageGenerator, Error> WEOM::getImageGenerator()
 
 etl::expected<void, Error> WEOM::setImageGenerator(ImageGenerator generator)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::TEST_PATTERN.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(generator);
     return writeData(data, MemorySpaceWEOM::TEST_PATTERN);
@@ -367,6 +1004,8 @@ etl::expected<void, Error> WEOM::setImageGenerator(ImageGenerator generator)
 
 etl::expected<ReticleType, Error> WEOM::getReticleType()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::RETICLE_TYPE>();
     if (!result.has_value())
     {
@@ -377,6 +1016,8 @@ etl::expected<ReticleType, Error> WEOM::getReticleType()
 
 etl::expected<void, Error> WEOM::setReticleType(ReticleType mode, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::RETICLE_TYPE.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(mode);
     return writeData(data, MemorySpaceWEOM::RETICLE_TYPE, memoryType);
@@ -384,6 +1025,8 @@ etl::expected<void, Error> WEOM::setReticleType(ReticleType mode, MemoryTypeWEOM
 
 etl::expected<int32_t, Error> WEOM::getReticlePositionX()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::RETICLE_POSITION_X>();
     if (!result.has_value())
     {
@@ -394,6 +1037,8 @@ etl::expected<int32_t, Error> WEOM::getReticlePositionX()
 
 etl::expected<void, Error> WEOM::setReticlePositionX(int32_t position, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::RETICLE_POSITION_X.getSize()> data = {};
     serialize(position, data.data(), data.size());
     return writeData(data, MemorySpaceWEOM::RETICLE_POSITION_X, memoryType);
@@ -401,6 +1046,8 @@ etl::expected<void, Error> WEOM::setReticlePositionX(int32_t position, MemoryTyp
 
 etl::expected<int32_t, Error> WEOM::getReticlePositionY()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::RETICLE_POSITION_Y>();
     if (!result.has_value())
     {
@@ -411,6 +1058,8 @@ etl::expected<int32_t, Error> WEOM::getReticlePositionY()
 
 etl::expected<void, Error> WEOM::setReticlePositionY(int32_t position, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::RETICLE_POSITION_Y.getSize()> data = {};
     serialize(position, data.data(), data.size());
     return writeData(data, MemorySpaceWEOM::RETICLE_POSITION_Y, memoryType);
@@ -418,6 +1067,8 @@ etl::expected<void, Error> WEOM::setReticlePositionY(int32_t position, MemoryTyp
 
 etl::expected<uint32_t, Error> WEOM::getShutterCounter()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::SHUTTER_COUNTER>();
     if (!result.has_value())
     {
@@ -428,6 +1079,8 @@ etl::expected<uint32_t, Error> WEOM::getShutterCounter()
 
 etl::expected<uint32_t, Error> WEOM::getTimeFromLastNucOffsetUpdate()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::TIME_FROM_LAST_NUC_OFFSET_UPDATE>();
     if (!result.has_value())
     {
@@ -438,6 +1091,8 @@ etl::expected<uint32_t, Error> WEOM::getTimeFromLastNucOffsetUpdate()
 
 etl::expected<InternalShutterPosition, Error> WEOM::getInternalShutterPosition()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::INTERNAL_SHUTTER_POSITION>();
     if (!result.has_value())
     {
@@ -448,6 +1103,8 @@ etl::expected<InternalShutterPosition, Error> WEOM::getInternalShutterPosition()
 
 etl::expected<void, Error> WEOM::setInternalShutterPosition(InternalShutterPosition position)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::INTERNAL_SHUTTER_POSITION.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(position);
     return writeData(data, MemorySpaceWEOM::INTERNAL_SHUTTER_POSITION);
@@ -455,6 +1112,8 @@ etl::expected<void, Error> WEOM::setInternalShutterPosition(InternalShutterPosit
 
 etl::expected<ShutterUpdateMode, Error> WEOM::getShutterUpdateMode()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::NUC_UPDATE_MODE_CURRENT>();
     if (!result.has_value())
     {
@@ -465,6 +1124,8 @@ etl::expected<ShutterUpdateMode, Error> WEOM::getShutterUpdateMode()
 
 etl::expected<double, Error> WEOM::getShutterTemperature()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::SHUTTER_TEMPERATURE>();
     if (!result.has_value())
     {
@@ -475,6 +1136,8 @@ etl::expected<double, Error> WEOM::getShutterTemperature()
 
 etl::expected<void, Error> WEOM::setShutterUpdateMode(ShutterUpdateMode mode, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::NUC_UPDATE_MODE_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(mode);
     return writeData(data, MemorySpaceWEOM::NUC_UPDATE_MODE_CURRENT, memoryType);
@@ -482,6 +1145,8 @@ etl::expected<void, Error> WEOM::setShutterUpdateMode(ShutterUpdateMode mode, Me
 
 etl::expected<uint16_t, Error> WEOM::getShutterMaxPeriod()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::NUC_MAX_PERIOD_CURRENT>();
     if (!result.has_value())
     {
@@ -492,6 +1157,8 @@ etl::expected<uint16_t, Error> WEOM::getShutterMaxPeriod()
 
 etl::expected<void, Error> WEOM::setShutterMaxPeriod(uint16_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::NUC_MAX_PERIOD_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(value & 0x00FF);
     data.at(1) = static_cast<uint8_t>((value & 0xFF00) >> 8);
@@ -500,6 +1167,8 @@ etl::expected<void, Error> WEOM::setShutterMaxPeriod(uint16_t value, MemoryTypeW
 
 etl::expected<double, Error> WEOM::getShutterAdaptiveThreshold()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::NUC_ADAPTIVE_THRESHOLD_CURRENT>();
     if (!result.has_value())
     {
@@ -510,6 +1179,8 @@ etl::expected<double, Error> WEOM::getShutterAdaptiveThreshold()
 
 etl::expected<void, Error> WEOM::setShutterAdaptiveThreshold(double value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     const auto fixedValue = doubleToFixedPoint(value);
     if (!fixedValue.has_value())
     {
@@ -523,6 +1194,8 @@ etl::expected<void, Error> WEOM::setShutterAdaptiveThreshold(double value, Memor
 
 etl::expected<Baudrate, Error> WEOM::getUartBaudrate()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::UART_BAUDRATE_CURRENT>();
     if (!result.has_value())
     {
@@ -533,6 +1206,8 @@ etl::expected<Baudrate, Error> WEOM::getUartBaudrate()
 
 etl::expected<void, Error> WEOM::setUartBaudrate(Baudrate baudrate, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::UART_BAUDRATE_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(baudrate);
     return writeData(data, MemorySpaceWEOM::UART_BAUDRATE_CURRENT, memoryType);
@@ -540,6 +1215,8 @@ etl::expected<void, Error> WEOM::setUartBaudrate(Baudrate baudrate, MemoryTypeWE
 
 etl::expected<TimeDomainAveraging, Error> WEOM::getTimeDomainAveraging()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::TIME_DOMAIN_AVERAGE_CURRENT>();
     if (!result.has_value())
     {
@@ -550,6 +1227,8 @@ etl::expected<TimeDomainAveraging, Error> WEOM::getTimeDomainAveraging()
 
 etl::expected<void, Error> WEOM::setTimeDomainAveraging(TimeDomainAveraging averaging, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::TIME_DOMAIN_AVERAGE_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(averaging);;
     return writeData(data, MemorySpaceWEOM::TIME_DOMAIN_AVERAGE_CURRENT, memoryType);
@@ -557,6 +1236,8 @@ etl::expected<void, Error> WEOM::setTimeDomainAveraging(TimeDomainAveraging aver
 
 etl::expected<ImageEqualizationType, Error> WEOM::getImageEqualizationType()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::IMAGE_EQUALIZATION_TYPE_CURRENT>();
     if (!result.has_value())
     {
@@ -567,6 +1248,8 @@ etl::expected<ImageEqualizationType, Error> WEOM::getImageEqualizationType()
 
 etl::expected<void, Error> WEOM::setImageEqualizationType(ImageEqualizationType type, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::IMAGE_EQUALIZATION_TYPE_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(type);
     return writeData(data, MemorySpaceWEOM::IMAGE_EQUALIZATION_TYPE_CURRENT, memoryType);
@@ -574,6 +1257,8 @@ etl::expected<void, Error> WEOM::setImageEqualizationType(ImageEqualizationType
 
 etl::expected<ContrastBrightness, Error> WEOM::getMgcContrastBrightness()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::MGC_CONTRAST_BRIGHTNESS_CURRENT>();
     if (!result.has_value())
     {
@@ -585,6 +1270,8 @@ etl::expected<ContrastBrightness, Error> WEOM::getMgcContrastBrightness()
 
 etl::expected<void, Error> WEOM::setMgcContrastBrightness(const ContrastBrightness& contrastBrightness, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::MGC_CONTRAST_BRIGHTNESS_CURRENT.getSize()> data = {};
     serialize(contrastBrightness.getContrastRaw(), data.data(), sizeof(uint16_t));
     serialize(contrastBrightness.getBrightnessRaw(), data.data() + sizeof(uint16_t), sizeof(uint16_t));
@@ -593,6 +1280,8 @@ etl::expected<void, Error> WEOM::setMgcContrastBrightness(const ContrastBrightne
 
 etl::expected<ContrastBrightness, Error> WEOM::getFrameBlockMedianConbright()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::FRAME_BLOCK_MEDIAN_CONBRIGHT>();
     if (!result.has_value())
     {
@@ -604,6 +1293,8 @@ etl::expected<ContrastBrightness, Error> WEOM::getFrameBlockMedianConbright()
 
 etl::expected<AGCNHSmoothing, Error> WEOM::getAgcNhSmoothingFrames()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::AGC_NH_SMOOTHING_CURRENT>();
     if (!result.has_value())
     {
@@ -614,6 +1305,8 @@ etl::expected<AGCNHSmoothing, Error> WEOM::getAgcNhSmoothingFrames()
 
 etl::expected<void, Error> WEOM::setAgcNhSmoothingFrames(AGCNHSmoothing smoothing, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::AGC_NH_SMOOTHING_CURRENT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(smoothing);
     return writeData(data, MemorySpaceWEOM::AGC_NH_SMOOTHING_CURRENT, memoryType);
@@ -621,6 +1314,8 @@ etl::expected<void, Error> WEOM::setAgcNhSmoothingFrames(AGCNHSmoothing smoothin
 
 etl::expected<bool, Error> WEOM::getSpatialMedianFilterEnabled()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::SPATIAL_MEDIAN_FILTER_ENABLE_CURRENT>();
     if (!result.has_value())
     {
@@ -631,6 +1326,8 @@ etl::expected<bool, Error> WEOM::getSpatialMedianFilterEnabled()
 
 etl::expected<void, Error> WEOM::setSpatialMedianFilterEnabled(bool enabled, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::SPATIAL_MEDIAN_FILTER_ENABLE_CURRENT.getSize()> data = {};
     data.at(0) = enabled ? 1 : 0;
     return writeData(data, MemorySpaceWEOM::SPATIAL_MEDIAN_FILTER_ENABLE_CURRENT, memoryType);
@@ -638,6 +1335,8 @@ etl::expected<void, Error> WEOM::setSpatialMedianFilterEnabled(bool enabled, Mem
 
 etl::expected<uint8_t, Error> WEOM::getLinearGainWeight()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::LINEAR_GAIN_WEIGHT>();
     if (!result.has_value())
     {
@@ -648,6 +1347,8 @@ etl::expected<uint8_t, Error> WEOM::getLinearGainWeight()
 
 etl::expected<void, Error> WEOM::setLinearGainWeight(uint8_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::LINEAR_GAIN_WEIGHT.getSize()> data = {};
     data.at(0) = value;
     return writeData(data, MemorySpaceWEOM::LINEAR_GAIN_WEIGHT, memoryType);
@@ -655,6 +1356,8 @@ etl::expected<void, Error> WEOM::setLinearGainWeight(uint8_t value, MemoryTypeWE
 
 etl::expected<uint8_t, Error> WEOM::getClipLimit()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::CLIP_LIMIT>();
     if (!result.has_value())
     {
@@ -665,6 +1368,8 @@ etl::expected<uint8_t, Error> WEOM::getClipLimit()
 
 etl::expected<void, Error> WEOM::setClipLimit(uint8_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::CLIP_LIMIT.getSize()> data = {};
     data.at(0) = value;
     return writeData(data, MemorySpaceWEOM::CLIP_LIMIT, memoryType);
@@ -672,6 +1377,8 @@ etl::expected<void, Error> WEOM::setClipLimit(uint8_t value, MemoryTypeWEOM memo
 
 etl::expected<uint8_t, Error> WEOM::getPlateauTailRejection()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::PLATEAU_TAIL_REJECTION>();
     if (!result.has_value())
     {
@@ -682,6 +1389,8 @@ etl::expected<uint8_t, Error> WEOM::getPlateauTailRejection()
 
 etl::expected<void, Error> WEOM::setPlateauTailRejection(uint8_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::PLATEAU_TAIL_REJECTION.getSize()> data = {};
     data.at(0) = value;
     return writeData(data, MemorySpaceWEOM::PLATEAU_TAIL_REJECTION, memoryType);
@@ -689,6 +1398,8 @@ etl::expected<void, Error> WEOM::setPlateauTailRejection(uint8_t value, MemoryTy
 
 etl::expected<uint8_t, Error> WEOM::getSmartTimeDomainAverageThreshold()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::SMART_TIME_DOMAIN_AVERAGE_THRESHOLD>();
     if (!result.has_value())
     {
@@ -699,6 +1410,8 @@ etl::expected<uint8_t, Error> WEOM::getSmartTimeDomainAverageThreshold()
 
 etl::expected<void, Error> WEOM::setSmartTimeDomainAverageThreshold(uint8_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::SMART_TIME_DOMAIN_AVERAGE_THRESHOLD.getSize()> data = {};
     data.at(0) = value;
     return writeData(data, MemorySpaceWEOM::SMART_TIME_DOMAIN_AVERAGE_THRESHOLD, memoryType);
@@ -706,6 +1419,8 @@ etl::expected<void, Error> WEOM::setSmartTimeDomainAverageThreshold(uint8_t valu
 
 etl::expected<uint8_t, Error> WEOM::getSmartMedianThreshold()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::SMART_MEDIAN_THRESHOLD>();
     if (!result.has_value())
     {
@@ -716,6 +1431,8 @@ etl::expected<uint8_t, Error> WEOM::getSmartMedianThreshold()
 
 etl::expected<void, Error> WEOM::setSmartMedianThreshold(uint8_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::SMART_MEDIAN_THRESHOLD.getSize()> data = {};
     data.at(0) = value;
     return writeData(data, MemorySpaceWEOM::SMART_MEDIAN_THRESHOLD, memoryType);
@@ -723,6 +1440,8 @@ etl::expected<void, Error> WEOM::setSmartMedianThreshold(uint8_t value, MemoryTy
 
 etl::expected<double, Error> WEOM::getGammaCorrection()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::GAMMA_CORRECTION>();
     if (!result.has_value())
     {
@@ -733,6 +1452,8 @@ etl::expected<double, Error> WEOM::getGammaCorrection()
 
 etl::expected<void, Error> WEOM::setGammaCorrection(double value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     const auto fixedValue = doubleToFixedPoint(value);
     if (!fixedValue.has_value())
     {
@@ -746,6 +1467,8 @@ etl::expected<void, Error> WEOM::setGammaCorrection(double value, MemoryTypeWEOM
 
 etl::expected<double, Error> WEOM::getMaxAmplification()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::MAX_AMPLIFICATION>();
     if (!result.has_value())
     {
@@ -756,6 +1479,8 @@ etl::expected<double, Error> WEOM::getMaxAmplification()
 
 etl::expected<void, Error> WEOM::setMaxAmplification(double value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     const auto fixedValue = doubleToFixedPoint(value, 13);
     if (!fixedValue.has_value())
     {
@@ -769,6 +1494,8 @@ etl::expected<void, Error> WEOM::setMaxAmplification(double value, MemoryTypeWEO
 
 etl::expected<uint8_t, Error> WEOM::getDampingFactor()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::DAMPING_FACTOR>();
     if (!result.has_value())
     {
@@ -779,6 +1506,8 @@ etl::expected<uint8_t, Error> WEOM::getDampingFactor()
 
 etl::expected<void, Error> WEOM::setDampingFactor(uint8_t value, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::DAMPING_FACTOR.getSize()> data = {};
     data.at(0) = value;
     return writeData(data, MemorySpaceWEOM::DAMPING_FACTOR, memoryType);
@@ -786,6 +1515,8 @@ etl::expected<void, Error> WEOM::setDampingFactor(uint8_t value, MemoryTypeWEOM
 
 etl::expected<PresetId, Error> WEOM::getPresetId(uint8_t index)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     if (!m_deviceInterface)
     {
         return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
@@ -818,6 +1549,8 @@ etl::expected<PresetId, Error> WEOM::getPresetId(uint8_t index)
 
 etl::expected<std::uint8_t, Error> WEOM::getPresetIdCount()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::NUMBER_OF_PRESETS_AND_ATTRIBUTES>();
     if (!result.has_value())
     {
@@ -828,6 +1561,8 @@ etl::expected<std::uint8_t, Error> WEOM::getPresetIdCount()
 
 etl::expected<PresetId, Error> WEOM::getPresetId()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::CURRENT_PRESET_ID>();
     if (!result.has_value())
     {
@@ -841,6 +1576,8 @@ etl::expected<PresetId, Error> WEOM::getPresetId()
 
 etl::expected<uint8_t, Error> WEOM::getPresetIndex()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto readResult = readAddressRange<MemorySpaceWEOM::CURRENT_PRESET_INDEX>();
     if (!readResult.has_value())
     {
@@ -851,6 +1588,8 @@ etl::expected<uint8_t, Error> WEOM::getPresetIndex()
 
 etl::expected<void, Error> WEOM::setPresetId(const PresetId& id)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::SELECTED_PRESET_ID.getSize()> data = {};
     data[0] = static_cast<uint8_t>(id.getRange());
     data[2] = static_cast<uint8_t>(id.getLens());
@@ -871,6 +1610,8 @@ etl::expected<void, Error> WEOM::setPresetId(const PresetId& id)
 
 etl::expected<void, Error> WEOM::setPresetId(uint8_t index)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::SELECTED_PRESET_INDEX.getSize()> data = {};
     data[0] = index;
     auto result = writeData(data, MemorySpaceWEOM::SELECTED_PRESET_INDEX);
@@ -888,6 +1629,8 @@ etl::expected<void, Error> WEOM::setPresetId(uint8_t index)
 
 etl::expected<void, Error> WEOM::saveCurrentPresetIndexToFlash()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto readResult = readAddressRange<MemorySpaceWEOM::CURRENT_PRESET_INDEX>();
     if (!readResult.has_value())
     {
@@ -903,6 +1646,8 @@ etl::expected<void, Error> WEOM::saveCurrentPresetIndexToFlash()
 
 etl::expected<VideoFormat, Error> WEOM::getVideoFormat()
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     auto result = readAddressRange<MemorySpaceWEOM::VIDEO_FORMAT>();
     if (!result.has_value())
     {
@@ -913,6 +1658,8 @@ etl::expected<VideoFormat, Error> WEOM::getVideoFormat()
 
 etl::expected<void, Error> WEOM::setVideoFormat(VideoFormat videoFormat, MemoryTypeWEOM memoryType)
 {
+    WL_TRACE_SPAN(m_tracer, __func__);
+
     etl::array<uint8_t, MemorySpaceWEOM::VIDEO_FORMAT.getSize()> data = {};
     data.at(0) = static_cast<uint8_t>(videoFormat);
     return writeData(data, MemorySpaceWEOM::VIDEO_FORMAT, memoryType);
@@ -924,6 +1671,19 @@ etl::expected<void, Error> WEOM::writeData(const etl::span<uint8_t>& data, const
     {
         return etl::unexpected<Error>(wl::Error::PROTOCOL__NO_DATALINK);
     }
+    if (m_stagedWrites)
+    {
+        // WEOM::apply and WEOM::Batch encode the settings through the setters without writing them
+        if (data.size() != MemorySpaceWEOM::REGISTERS_MINIMUM_DATA_SIZE || m_stagedWrites->full())
+        {
+            return etl::unexpected<Error>(Error::DEVICE__INVALID_DATA_SIZE);
+        }
+        StagedWrite stagedWrite {addressRange, memoryType, {}, 0};
+        etl::copy(data.begin(), data.end(), stagedWrite.data.begin());
+        m_stagedWrites->push_back(stagedWrite);
+        return {};
+    }
+
     auto firstAddress = addressRange.getFirstAddress();
     switch (memoryType) {
     case MemoryTypeWEOM::REGISTERS_CONFIGURATION:
@@ -932,7 +1692,70 @@ etl::expected<void, Error> WEOM::writeData(const etl::span<uint8_t>& data, const
         firstAddress += MemorySpaceWEOM::ADDRESS_FLASH_REGISTERS_START;
         break;
     }
-    return m_deviceInterface->writeData(data, firstAddress);
+    auto result = m_deviceInterface->writeData(data, firstAddress);
+    if (result.has_value() && memoryType == MemoryTypeWEOM::REGISTERS_CONFIGURATION)
+    {
+        m_registerCache.store(addressRange, data);
+    }
+    else
+    {
+        // failed write may have been applied partially, value in flash may be loaded later
+        m_registerCache.invalidate(addressRange);
+    }
+    return result;
+}
+
+etl::expected<void, Error> WEOM::writeStagedWrites(etl::span<const StagedWrite> stagedWrites)
+{
+    // adjacent registers of the same memory in a single transfer
+    static constexpr uint32_t REGISTER_SIZE = MemorySpaceWEOM::REGISTERS_MINIMUM_DATA_SIZE;
+    assert(!stagedWrites.empty() && stagedWrites.size() <= STAGED_WRITES_CAPACITY);
+
+    etl::array<uint8_t, STAGED_WRITES_CAPACITY * REGISTER_SIZE> data = {};
+    for (size_t i = 0; i < stagedWrites.size(); ++i)
+    {
+        assert(i == 0 || stagedWrites[i].addressRange.getFirstAddress() == stagedWrites[i - 1].addressRange.getLastAddress() + 1);
+        assert(stagedWrites[i].memoryType == stagedWrites.front().memoryType);
+        etl::copy(stagedWrites[i].data.begin(), stagedWrites[i].data.end(), data.begin() + i * REGISTER_SIZE);
+    }
+
+    const auto memoryType = stagedWrites.front().memoryType;
+    const auto addressRange = AddressRange::firstToLast(stagedWrites.front().addressRange.getFirstAddress(),
+                                                        stagedWrites.back().addressRange.getLastAddress());
+    auto result = writeData(etl::span<uint8_t>(data).first(addressRange.getSize()), addressRange, memoryType);
+    if (!result.has_value() || memoryType != MemoryTypeWEOM::REGISTERS_CONFIGURATION)
+    {
+        return result;
+    }
+
+    // cache entries match the ranges of the getters
+    for (size_t i = 0; i < stagedWrites.size(); ++i)
+    {
+        if (stagedWrites[i].addressRange == MemorySpaceWEOM::TRIGGER)
+        {
+            m_registerCache.invalidate(static_cast<Trigger>(deserialize<uint32_t>(etl::span<uint8_t>(data).subspan(i * REGISTER_SIZE, REGISTER_SIZE))));
+        }
+        else
+        {
+            m_registerCache.store(stagedWrites[i].addressRange, stagedWrites[i].data);
+        }
+    }
+    return {};
+}
+
+etl::expected<void, Error> WEOM::checkDeviceIdentificator()
+{
+    // bypasses the register cache, the read also tells whether the device responds
+    const auto result = m_deviceInterface->readAddressRange<MemorySpaceWEOM::DEVICE_IDENTIFICATOR>();
+    if (!result.has_value())
+    {
+        return etl::unexpected<Error>(result.error());
+    }
+    if (!isWeomIdentificator(result.value()))
+    {
+        return etl::unexpected<Error>(Error::DEVICE__NO_PROTOCOL);
+    }
+    return {};
 }
 
 template <const AddressRange& addressRange>
@@ -942,6 +1765,176 @@ etl::expected<etl::array<uint8_t, addressRange.getSize()>, Error> WEOM::readAddr
     {
         return etl::unexpected<Error>(Error::PROTOCOL__NO_DATALINK);
     }
-    return m_deviceInterface->readAddressRange<addressRange>();
+
+    etl::array<uint8_t, addressRange.getSize()> data = {};
+    if (m_recordedRanges)
+    {
+        // WEOM::Batch collects the registers read by the getters
+        if (!m_recordedRanges->full())
+        {
+            m_recordedRanges->push_back(addressRange);
+        }
+        return data;
+    }
+
+    for (const auto& prefetchedRange : m_prefetchedRanges)
+    {
+        if (prefetchedRange.addressRange.contains(addressRange))
+        {
+            const auto offset = addressRange.getFirstAddress() - prefetchedRange.addressRange.getFirstAddress();
+            etl::copy_n(prefetchedRange.data.begin() + offset, data.size(), data.begin());
+            m_registerCache.store(addressRange, data);
+            return data;
+        }
+    }
+
+    if (m_registerCache.read(addressRange, data))
+    {
+        return data;
+    }
+
+    auto result = m_deviceInterface->readAddressRange<addressRange>();
+    if (result.has_value())
+    {
+        m_registerCache.store(addressRange, result.value());
+    }
+    return result;
+}
+WEOM::Batch::Batch(WEOM& weom) :
+    m_weom(weom)
+{
 }
+
+etl::expected<void, Error> WEOM::Batch::execute()
+{
+    WL_TRACE_SPAN(m_weom.m_tracer, "Batch::execute");
+
+    etl::optional<Error> error;
+    if (!m_weom.m_deviceInterface)
+    {
+        error = Error::PROTOCOL__NO_DATALINK;
+    }
+
+    for (auto* result : m_setterResults)
+    {
+        *result = {};
+    }
+    const auto setError = [this](size_t item, Error error)
+    {
+        if (m_setterResults.at(item)->has_value())
+        {
+            *m_setterResults.at(item) = etl::unexpected<Error>(error);
+        }
+    };
+
+    // writes are sorted between control registers, their order matters (e.g. selected preset and its trigger)
+    const auto isControl = [](const StagedWrite& write)
+    {
+        return MemorySpaceWEOM::getRegisterClass(write.addressRange) == RegisterClassWEOM::CONTROL;
+    };
+    for (auto segment = m_writes.begin(); segment != m_writes.end();)
+    {
+        const auto segmentEnd = etl::find_if(segment, m_writes.end(), isControl);
+        etl::stable_sort(segment, segmentEnd, [](const StagedWrite& a, const StagedWrite& b)
+        {
+            if (a.memoryType != b.memoryType)
+            {
+                return a.memoryType < b.memoryType;
+            }
+            return a.addressRange.getFirstAddress() < b.addressRange.getFirstAddress();
+        });
+        segment = segmentEnd == m_writes.end() ? segmentEnd : segmentEnd + 1;
+    }
+
+    for (size_t first = 0; first < m_writes.size();)
+    {
+        size_t last = first;
+        while (!isControl(m_writes.at(first)) && last + 1 < m_writes.size() && !isControl(m_writes.at(last + 1)) &&
+               m_writes.at(last + 1).memoryType == m_writes.at(first).memoryType &&
+               m_writes.at(last + 1).addressRange.getFirstAddress() == m_writes.at(last).addressRange.getLastAddress() + 1)
+        {
+            ++last;
+        }
+
+        if (!error.has_value())
+        {
+            const auto run = etl::span<const StagedWrite>(m_writes).subspan(first, last - first + 1);
+            if (const auto result = m_weom.writeStagedWrites(run); !result.has_value())
+            {
+                error = result.error();
+            }
+        }
+
+        if (error.has_value())
+        {
+            for (size_t i = first; i <= last; ++i)
+            {
+                setError(m_writes.at(i).item, error.value());
+            }
+        }
+        first = last + 1;
+    }
+
+    // registers of the getters, nearby ones are read together, cached ones are not read at all
+    etl::array<uint8_t, DATA_CAPACITY> data = {};
+    etl::span<uint8_t> freeData = data;
+    etl::vector<PrefetchedRange, 2 * CAPACITY> prefetchedRanges;
+    etl::vector<IDeviceInterface::ReadRequest, 2 * CAPACITY> requests;
+    for (const auto& addressRange : m_reads)
+    {
+        etl::array<uint8_t, RegisterCacheWEOM::MAXIMUM_ENTRY_SIZE> cachedData = {};
+        if (addressRange.getSize() > freeData.size() ||
+            (addressRange.getSize() <= cachedData.size() &&
+             m_weom.m_registerCache.read(addressRange, etl::span<uint8_t>(cachedData).first(addressRange.getSize()))))
+        {
+            continue;
+        }
+
+        const auto registerData = freeData.first(addressRange.getSize());
+        freeData = freeData.subspan(addressRange.getSize());
+        prefetchedRanges.push_back(PrefetchedRange{addressRange, registerData});
+        requests.push_back(IDeviceInterface::ReadRequest{registerData, addressRange.getFirstAddress()});
+    }
+
+    if (!error.has_value() && !requests.empty())
+    {
+        if (const auto result = m_weom.m_deviceInterface->readMany(requests); !result.has_value())
+        {
+            error = result.error();
+        }
+    }
+
+    // decode by the getters, registers not prefetched are read by the getters themselves and that read may fail
+    m_weom.m_prefetchedRanges = prefetchedRanges;
+    etl::optional<Error> getterError;
+    for (auto& getter : m_getters)
+    {
+        if (const auto result = getter.decode(getter, m_weom, error); result.has_value() && !getterError.has_value())
+        {
+            getterError = result;
+        }
+    }
+    if (!error.has_value())
+    {
+        error = getterError;
+    }
+    m_weom.m_prefetchedRanges = {};
+
+    clear();
+
+    if (error.has_value())
+    {
+        return etl::unexpected<Error>(error.value());
+    }
+    return {};
+}
+
+void WEOM::Batch::clear()
+{
+    m_writes.clear();
+    m_setterResults.clear();
+    m_reads.clear();
+    m_getters.clear();
+}
+
 } // namespace wl
@@ -21,14 +21,22 @@
 #include "wl/dataclasses/reticletype.h"
 #include "wl/dataclasses/internalshutterposition.h"
 #include "wl/dataclasses/baudrate.h"
+#include "wl/dataclasses/configurationsnapshot.h"
 
 #include "wl/communication/protocolinterfacetcsi.h"
 #include "wl/weom/deviceinterfaceweom.h"
+#include "wl/weom/registercacheweom.h"
 #include "wl/communication/idatalinkinterface.h"
 #include "wl/communication/ideviceinterface.h"
+#include "wl/misc/tracer.h"
 
 #include <etl/string.h>
 #include <etl/expected.h>
+#include <etl/vector.h>
+#include <etl/optional.h>
+#include <etl/utility.h>
+
+#include <cstring>
 
 
 namespace wl {
@@ -63,6 +71,171 @@ public:
      */
     [[nodiscard]] etl::expected<void, Error> setDataLinkInterface(etl::unique_ptr<IDataLinkInterface> dataLinkInterface);
 
+    /**
+     * @brief Sets how many TCSI requests may be in flight at once.
+     *
+     * With depth greater than 1 transfers split into several packets are sent without waiting for each response,
+     * responses are matched by packet ID. If a response of a pipelined window is lost, the depth drops back to 1.
+     * The setting is kept across `WEOM::setDataLinkInterface` calls.
+     * @param depth Pipeline depth (1 - ProtocolInterfaceTCSI::MAX_PIPELINE_DEPTH), default is 1.
+     */
+    void setPipelineDepth(uint8_t depth);
+
+    /**
+     * @brief Retrieves the current pipeline depth.
+     * @return Number of TCSI requests kept in flight.
+     */
+    uint8_t getPipelineDepth() const;
+
+    /**
+     * @brief Sets the limits of the time the device may take to respond to a request.
+     *
+     * Response timeouts follow the measured device turnaround time plus the time on the wire at the baud rate
+     * reported by `IDataLinkInterface::getBaudrate`, the turnaround part is clamped to these limits.
+     * The setting is kept across `WEOM::setDataLinkInterface` calls.
+     * @param minimumTimeout Lower limit, default is DeviceInterfaceWEOM::MINIMUM_TIMEOUT_DEFAULT.
+     * @param maximumTimeout Upper limit also used before the first response is measured, default is DeviceInterfaceWEOM::MAXIMUM_TIMEOUT_DEFAULT.
+     * @see DeviceInterfaceWEOM::setTimeoutLimits
+     */
+    void setTimeoutLimits(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout);
+
+    /**
+     * @brief Sets whether `WEOM::setDataLinkInterface` calls `WEOM::upgradeBaudrate` after identifying the device.
+     *
+     * Data links which do not report a `Baudrate` line speed stay as they are. Disabled by default,
+     * the setting is kept across `WEOM::setDataLinkInterface` calls.
+     * @param enabled True to switch to the fastest baud rate supported by both the data link and the device on connect.
+     */
+    void setAutomaticBaudrateUpgrade(bool enabled);
+
+    /**
+     * @brief Switches the device and the data link to the fastest baud rate both support.
+     *
+     * Baud rates faster than the current line speed are tried from the fastest one, skipping those rejected by
+     * `IDataLinkInterface::isBaudrateSupported`. For each the device is told to switch (`UART_BAUDRATE_CURRENT`),
+     * the data link follows by `IDataLinkInterface::setBaudrate` and the device identificator is read back.
+     * When the read fails (after the retries of a single read, i.e. a few response timeouts), the data link
+     * returns to the previous baud rate and the next slower one is tried.
+     * Only the current register is written, the device starts at its configured baud rate after a power cycle.
+     * @return An `etl::expected<Baudrate, Error>` containing the baud rate in use, `DATALINK__UNSUPPORTED_BAUDRATE`
+     * if the current line speed (see `IDataLinkInterface::getBaudrate`) is not a `Baudrate` value, or another error
+     * if the device does not respond at the previous speed either.
+     * @see registers_uart_baudrate
+     */
+    [[nodiscard]] etl::expected<Baudrate, Error> upgradeBaudrate();
+
+    /**
+     * @brief Sets whether `WEOM::setDataLinkInterface` finds the baud rate of the device by `WEOM::detectBaudrate`
+     * instead of assuming the data link is already set to it.
+     *
+     * Disabled by default, the setting is kept across `WEOM::setDataLinkInterface` calls.
+     * @param enabled True to probe the baud rates on connect.
+     */
+    void setBaudrateAutodetection(bool enabled);
+
+    /**
+     * @brief Finds the baud rate the device talks at and switches the data link to it.
+     *
+     * The device identificator is read once at each baud rate, without retries and waiting only for the time on the wire
+     * plus the minimum timeout (see `WEOM::setTimeoutLimits`), so a device left at any `Baudrate` is found in tens of
+     * milliseconds. The last known baud rate is probed first, then the current one of the data link and the remaining
+     * ones from 115200 Bd. Baud rates other than the current one are probed only if `IDataLinkInterface::isBaudrateSupported`.
+     * @return An `etl::expected<Baudrate, Error>` containing the detected baud rate or the error of the last probe,
+     * the data link returns to its original baud rate then.
+     */
+    [[nodiscard]] etl::expected<Baudrate, Error> detectBaudrate();
+
+    /**
+     * @brief Sets the baud rate probed first by `WEOM::detectBaudrate`, e.g. restored from non-volatile memory.
+     * @param baudrate The last known working baud rate.
+     */
+    void setLastKnownBaudrate(Baudrate baudrate);
+
+    /**
+     * @brief Retrieves the baud rate of the last successful connect, detection or upgrade.
+     * @return The baud rate, none if the device has not responded at a `Baudrate` yet.
+     */
+    etl::optional<Baudrate> getLastKnownBaudrate() const;
+
+    /**
+     * @brief Sets the tracer receiving spans of the API calls and of the device and protocol operations they make.
+     *
+     * The spans form a call stack, e.g. setPresetId > writeData > TCSI write request, TCSI wait for response, busy sleep, retry.
+     * They are written only when the library is built with `WL_ENABLE_TRACING` (CMake option `WEOMLINK_ENABLE_TRACING`),
+     * otherwise the call has no effect and the instrumentation costs nothing.
+     * The setting is kept across `WEOM::setDataLinkInterface` calls.
+     * @param tracer The tracer, it has to outlive this instance or be replaced; nullptr stops tracing.
+     * @see Tracer
+     */
+    void setTracer(Tracer* tracer);
+
+    /**
+     * @brief Sets whether getters of a register class are served from a shadow copy instead of the device.
+     *
+     * The shadow copy is updated by successful getters and setters. Entries are invalidated after triggers
+     * (see `RegisterCacheWEOM::invalidate(Trigger)`), on `WEOM::setDataLinkInterface` and when `WEOM::getStatus`
+     * reports registers changed by the device - poll the status periodically when caching configuration registers.
+     * Caching is disabled by default, the setting is kept across `WEOM::setDataLinkInterface` calls.
+     * @param registerClass The register class (see `MemorySpaceWEOM::getRegisterClass`), control registers are never cached.
+     * @param policy The caching policy.
+     */
+    void setRegisterCachePolicy(RegisterClassWEOM registerClass, RegisterCachePolicyWEOM policy);
+
+    /**
+     * @brief Discards all values in the shadow copy of registers.
+     */
+    void clearRegisterCache();
+
+    /**
+     * @struct Statistics
+     * @brief Communication counters and latency histograms of the protocol layers.
+     */
+    struct Statistics
+    {
+        ProtocolInterfaceTCSI::Statistics protocol; ///< TCSI traffic - requests, bytes, failed requests.
+        DeviceInterfaceWEOM::Statistics device;     ///< Reads and writes - retries, busy waits, errors and latencies.
+    };
+
+    /**
+     * @brief Retrieves the communication statistics collected since construction or `WEOM::resetStatistics`.
+     *
+     * The statistics are accumulated across `WEOM::setDataLinkInterface` calls. They are collected only when the library
+     * is built with `WL_ENABLE_STATISTICS` (CMake option `WEOMLINK_ENABLE_STATISTICS`), otherwise all values are zero
+     * and the collection costs nothing.
+     * @return Copy of the statistics.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Sets all communication statistics to zero.
+     */
+    void resetStatistics();
+
+    /**
+     * @brief Reads all registers of the register groups at once.
+     *
+     * Nearby registers are read together (see `DeviceInterfaceWEOM::readMany`), so the whole configuration costs a few
+     * transfers instead of a round trip per getter. The values are decoded the same way as by the getters and are stored into the register cache.
+     * @return An `etl::expected<ConfigurationSnapshot, Error>` containing the decoded registers or an error.
+     * @see registers
+     */
+    [[nodiscard]] etl::expected<ConfigurationSnapshot, Error> readSnapshot();
+
+    /**
+     * @brief Writes the settings of a snapshot which differ from the device.
+     *
+     * The preset (`ConfigurationSnapshot::presetIndex`) is selected first, because selecting a preset reloads the other settings.
+     * The writable registers are then compared with the device (values in the register cache are not read again)
+     * and only the changed ones are written, adjacent changed registers in a single transfer.
+     * Read-only values and the UART baudrate (it would break the connection) are not applied.
+     * @param target The settings to apply, typically obtained by `WEOM::readSnapshot`.
+     * @param memoryType The memory to apply to, settings without a flash copy (e.g. frame rate) are applied to registers only.
+     * @return An `etl::expected<void, Error>` indicating success or failure.
+     */
+    [[nodiscard]] etl::expected<void, Error> apply(const ConfigurationSnapshot& target, MemoryTypeWEOM memoryType);
+
+    class Batch;
+
     /**
      * @brief Retrieves the current status of the device.
      * @return An `etl::expected<Status, Error>` containing the device status or an error.
@@ -706,15 +879,200 @@ public:
 private:
     etl::unique_ptr<DeviceInterfaceWEOM> m_deviceInterface;
     uint8_t m_lastPacketId;
+    uint8_t m_pipelineDepth {1};
+    Clock::duration m_minimumTimeout {DeviceInterfaceWEOM::MINIMUM_TIMEOUT_DEFAULT};
+    Clock::duration m_maximumTimeout {DeviceInterfaceWEOM::MAXIMUM_TIMEOUT_DEFAULT};
+    bool m_automaticBaudrateUpgrade {false};
+    bool m_baudrateAutodetection {false};
+    etl::optional<Baudrate> m_lastKnownBaudrate;
     SleepFunction m_sleepFunction;
+    RegisterCacheWEOM m_registerCache;
+#ifdef WL_ENABLE_STATISTICS
+    Statistics m_previousLinksStatistics; // of the interfaces replaced by setDataLinkInterface
+#endif
+#ifdef WL_ENABLE_TRACING
+    Tracer* m_tracer {nullptr};
+#endif
+
+    struct PrefetchedRange
+    {
+        AddressRange addressRange;
+        etl::span<const uint8_t> data;
+    };
+    etl::span<const PrefetchedRange> m_prefetchedRanges;
+
+    static constexpr size_t STAGED_WRITES_CAPACITY = 40;
+    struct StagedWrite
+    {
+        AddressRange addressRange;
+        MemoryTypeWEOM memoryType;
+        etl::array<uint8_t, MemorySpaceWEOM::REGISTERS_MINIMUM_DATA_SIZE> data;
+        size_t item;
+    };
+    etl::ivector<StagedWrite>* m_stagedWrites {nullptr};
+    etl::ivector<AddressRange>* m_recordedRanges {nullptr};
+
+    [[nodiscard]] etl::expected<void, Error> checkDeviceIdentificator();
 
     template <const AddressRange& addressRange>
     etl::expected<etl::array<uint8_t, addressRange.getSize()>, Error> readAddressRange();
 
     etl::expected<void, Error> writeData(const etl::span<uint8_t>& data, const AddressRange& addressRange, MemoryTypeWEOM memoryType = MemoryTypeWEOM::REGISTERS_CONFIGURATION);
+    etl::expected<void, Error> writeStagedWrites(etl::span<const StagedWrite> stagedWrites);
 };
 /** @} */
 
+/**
+ * @class WEOM::Batch
+ * @headerfile weom.h "wl/weom.h"
+ * @brief Queue of WEOM getters and setters executed together.
+ *
+ * @details
+ * Setters are encoded when queued and getters only note the registers they read. `Batch::execute` then writes the queued
+ * settings (adjacent registers of the same memory in a single transfer, writes of control registers such as triggers
+ * keep their order), reads the registers of all queued getters in as few transfers as possible and decodes them.
+ * Each queued getter and setter gets its own result. Only getters without parameters can be queued.
+ *
+ * @code
+ * etl::expected<uint8_t, Error> clipLimit;
+ * etl::expected<void, Error> gammaResult;
+ * WEOM::Batch batch(weom);
+ * batch.get(&WEOM::getClipLimit, clipLimit);
+ * batch.set(&WEOM::setGammaCorrection, gammaResult, 1.5, MemoryTypeWEOM::REGISTERS_CONFIGURATION);
+ * auto result = batch.execute();
+ * @endcode
+ */
+class WEOM::Batch
+{
+public:
+    static constexpr size_t CAPACITY = 16;         ///< Maximum number of queued getters and of queued setters.
+    static constexpr size_t DATA_CAPACITY = 256;   ///< Bytes of registers read for the getters, registers above it are read by the getters themselves.
+
+    /**
+     * @brief Creates an empty batch.
+     * @param weom The device the batch is executed on, it has to outlive the batch.
+     */
+    explicit Batch(WEOM& weom);
+
+    /**
+     * @brief Queues a getter.
+     * @param getter The getter, e.g. `&WEOM::getClipLimit`.
+     * @param result Receives the value or an error on `Batch::execute`, it has to outlive the execution.
+     */
+    template <typename T>
+    void get(etl::expected<T, Error> (WEOM::*getter)(), etl::expected<T, Error>& result);
+
+    /**
+     * @brief Queues a setter.
+     *
+     * The value is encoded immediately - if it cannot be encoded, the error is stored into the result and nothing is written.
+     * @param setter The setter, e.g. `&WEOM::setClipLimit`.
+     * @param result Receives success or an error on `Batch::execute`, it has to outlive the execution.
+     * @param arguments The arguments of the setter.
+     */
+    template <typename... Parameters, typename... Arguments>
+    void set(etl::expected<void, Error> (WEOM::*setter)(Parameters...), etl::expected<void, Error>& result, Arguments&&... arguments);
+
+    /**
+     * @brief Executes the queued setters, then the queued getters, and empties the batch.
+     *
+     * After a failed transfer the remaining items are not executed and receive the same error.
+     * @return An `etl::expected<void, Error>` indicating success or the first error.
+     */
+    [[nodiscard]] etl::expected<void, Error> execute();
+
+private:
+    using AnyGetter = etl::expected<uint8_t, Error> (WEOM::*)(); // member function pointers of WEOM getters share one size
+
+    /**
+     * @brief Queued getter, stored in place without allocation.
+     *
+     * The capture budget is the member function pointer of the getter and the address of its result - all getters of WEOM
+     * have a member function pointer of the size of AnyGetter.
+     */
+    struct Getter
+    {
+        // stores the value or the error into the result, returns the getter's error
+        using Decode = etl::optional<Error> (*)(const Getter& getter, WEOM& weom, const etl::optional<Error>& error);
+
+        Decode decode {nullptr};
+        void* result {nullptr};
+        alignas(AnyGetter) uint8_t memberFunction[sizeof(AnyGetter)] {};
+    };
+
+    template <typename T>
+    static etl::optional<Error> decodeGetter(const Getter& getter, WEOM& weom, const etl::optional<Error>& error);
+
+    WEOM& m_weom;
+    etl::vector<StagedWrite, STAGED_WRITES_CAPACITY> m_writes;
+    etl::vector<etl::expected<void, Error>*, CAPACITY> m_setterResults;
+    etl::vector<AddressRange, 2 * CAPACITY> m_reads;
+    etl::vector<Getter, CAPACITY> m_getters;
+
+    void clear();
+};
+
+template <typename T>
+void WEOM::Batch::get(etl::expected<T, Error> (WEOM::*getter)(), etl::expected<T, Error>& result)
+{
+    assert(!m_getters.full());
+
+    // the getter only records the registers it reads
+    m_weom.m_recordedRanges = &m_reads;
+    (void)(m_weom.*getter)();
+    m_weom.m_recordedRanges = nullptr;
+
+    static_assert(sizeof(getter) == sizeof(Getter::memberFunction), "getter does not fit the capture budget of Batch::Getter");
+    Getter queuedGetter;
+    queuedGetter.decode = &decodeGetter<T>;
+    queuedGetter.result = &result;
+    std::memcpy(queuedGetter.memberFunction, &getter, sizeof(getter));
+    m_getters.push_back(queuedGetter);
+}
+
+template <typename T>
+etl::optional<Error> WEOM::Batch::decodeGetter(const Getter& getter, WEOM& weom, const etl::optional<Error>& error)
+{
+    auto& result = *static_cast<etl::expected<T, Error>*>(getter.result);
+    if (error.has_value())
+    {
+        result = etl::unexpected<Error>(error.value());
+        return etl::nullopt;
+    }
+
+    etl::expected<T, Error> (WEOM::*memberFunction)();
+    std::memcpy(&memberFunction, getter.memberFunction, sizeof(memberFunction));
+    result = (weom.*memberFunction)();
+    if (!result.has_value())
+    {
+        return result.error();
+    }
+    return etl::nullopt;
+}
+
+template <typename... Parameters, typename... Arguments>
+void WEOM::Batch::set(etl::expected<void, Error> (WEOM::*setter)(Parameters...), etl::expected<void, Error>& result, Arguments&&... arguments)
+{
+    assert(!m_setterResults.full());
+
+    const auto firstWrite = m_writes.size();
+    m_weom.m_stagedWrites = &m_writes;
+    result = (m_weom.*setter)(etl::forward<Arguments>(arguments)...);
+    m_weom.m_stagedWrites = nullptr;
+
+    if (!result.has_value())
+    {
+        m_writes.erase(m_writes.begin() + firstWrite, m_writes.end());
+        return;
+    }
+
+    for (size_t i = firstWrite; i < m_writes.size(); ++i)
+    {
+        m_writes.at(i).item = m_setterResults.size();
+    }
+    m_setterResults.push_back(&result);
+}
+
 } // namespace wl
 
 #endif // WL_WEOM_H
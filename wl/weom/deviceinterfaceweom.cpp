@@ -1,9 +1,21 @@
 #include "wl/weom/deviceinterfaceweom.h"
 #include "wl/communication/protocolinterfacetcsi.h"
+#include "wl/misc/elapsedtimer.h"
+#include "wl/misc/logger.h"
+#include "wl/misc/tracer.h"
+#include <algorithm>
 #include <cmath>
 
 namespace wl {
 
+namespace {
+
+Clock::time_point getStatisticsTime()
+{
+    return STATISTICS_ENABLED ? Clock::now() : Clock::time_point();
+}
+
+} // namespace
 
 DeviceInterfaceWEOM::DeviceInterfaceWEOM(etl::unique_ptr<ProtocolInterfaceTCSI> protocolInterface, SleepFunction sleepFunction) :
     BaseClass(BaseClass::DeviceEndianity::LITTLE),
@@ -31,11 +43,13 @@ etl::expected<void, Error> DeviceInterfaceWEOM::readData(etl::span<uint8_t> data
         return etl::unexpected<Error>(memoryDescriptor.error());
     }
 
-    return readDataImpl(data, address, getMaxDataSize(memoryDescriptor.value()));
+    return readDataImpl(data, address, memoryDescriptor.value().type, getMaxDataSize(memoryDescriptor.value()));
 }
 
 etl::expected<void, Error> DeviceInterfaceWEOM::writeData(const etl::span<const uint8_t> data, uint32_t address)
 {
+    WL_TRACE_SPAN(m_tracer, "writeData", .address = address, .size = static_cast<uint32_t>(data.size()));
+
     const auto memoryDescriptor = getMemoryDescriptorWithChecks(address, data.size());
     if (!memoryDescriptor.has_value())
     {
@@ -46,31 +60,384 @@ etl::expected<void, Error> DeviceInterfaceWEOM::writeData(const etl::span<const
     Duration busyDelayTotal = std::chrono::milliseconds(0);
     ErrorWindow lastErrors;
 
-    return writeDataImpl(data, address, TIMEOUT_DEFAULT, maxDataSize, busyDelayTotal, lastErrors);
+    const auto startTime = getStatisticsTime();
+    const auto result = memoryDescriptor.value().type == MemoryTypeWEOM::FLASH_MEMORY ?
+                        writeFlashDataImpl(data, address, maxDataSize, busyDelayTotal, lastErrors) :
+                        writeDataImpl(data, address, memoryDescriptor.value().type, maxDataSize, busyDelayTotal, lastErrors);
+    countOperation(Operation::WRITE, memoryDescriptor.value().type, startTime, result);
+    WL_TRACE_SPAN_RESULT(result);
+    return result;
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::readMany(etl::span<const ReadRequest> requests)
+{
+    WL_TRACE_SPAN(m_tracer, "readMany");
+
+    if (requests.size() > MANY_REQUESTS_CAPACITY)
+    {
+        for (size_t i = 0; i < requests.size(); i += MANY_REQUESTS_CAPACITY)
+        {
+            if (const auto result = readMany(requests.subspan(i, std::min(MANY_REQUESTS_CAPACITY, requests.size() - i))); !result.has_value())
+            {
+                return result;
+            }
+        }
+        return {};
+    }
+
+    etl::vector<const ReadRequest*, MANY_REQUESTS_CAPACITY> sortedRequests;
+    for (const auto& request : requests)
+    {
+        if (const auto memoryDescriptor = getMemoryDescriptorWithChecks(request.address, request.data.size()); !memoryDescriptor.has_value())
+        {
+            return etl::unexpected<Error>(memoryDescriptor.error());
+        }
+        sortedRequests.push_back(&request);
+    }
+    std::stable_sort(sortedRequests.begin(), sortedRequests.end(), [](const ReadRequest* a, const ReadRequest* b)
+    {
+        return a->address < b->address;
+    });
+
+    for (size_t first = 0; first < sortedRequests.size();)
+    {
+        const auto memoryDescriptor = getMemoryDescriptorWithChecks(sortedRequests.at(first)->address, sortedRequests.at(first)->data.size()).value();
+        const uint32_t maxDataSize = getMaxDataSize(memoryDescriptor);
+        const uint64_t gapLimit = getReadGapLimit(memoryDescriptor.type);
+
+        auto addressRange = AddressRange::firstAndSize(sortedRequests.at(first)->address, sortedRequests.at(first)->data.size());
+        size_t last = first;
+        while (last + 1 < sortedRequests.size())
+        {
+            const auto nextRange = AddressRange::firstAndSize(sortedRequests.at(last + 1)->address, sortedRequests.at(last + 1)->data.size());
+            const auto mergedRange = AddressRange::firstToLast(addressRange.getFirstAddress(), std::max(addressRange.getLastAddress(), nextRange.getLastAddress()));
+            if (nextRange.getFirstAddress() > uint64_t(addressRange.getLastAddress()) + 1 + gapLimit ||
+                mergedRange.getSize() > std::min<uint32_t>(maxDataSize, COALESCED_DATA_CAPACITY) ||
+                !memoryDescriptor.addressRange.contains(mergedRange))
+            {
+                break;
+            }
+            // the device answers unmapped register addresses with an error status, so a gap in registers is read only over known registers
+            if (memoryDescriptor.type == MemoryTypeWEOM::REGISTERS_CONFIGURATION &&
+                nextRange.getFirstAddress() > addressRange.getLastAddress() + 1 &&
+                !MemorySpaceWEOM::isReadable(AddressRange::firstToLast(addressRange.getLastAddress() + 1, nextRange.getFirstAddress() - 1)))
+            {
+                break;
+            }
+            addressRange = mergedRange;
+            ++last;
+        }
+
+        if (first == last)
+        {
+            if (const auto result = readDataImpl(sortedRequests.at(first)->data, addressRange.getFirstAddress(), memoryDescriptor.type, maxDataSize); !result.has_value())
+            {
+                return result;
+            }
+        }
+        else
+        {
+            etl::array<uint8_t, COALESCED_DATA_CAPACITY> data = {};
+            const auto mergedData = etl::span<uint8_t>(data).first(addressRange.getSize());
+            if (const auto result = readDataImpl(mergedData, addressRange.getFirstAddress(), memoryDescriptor.type, maxDataSize); !result.has_value())
+            {
+                return result;
+            }
+            for (size_t i = first; i <= last; ++i)
+            {
+                const auto& request = *sortedRequests.at(i);
+                std::copy_n(mergedData.begin() + (request.address - addressRange.getFirstAddress()), request.data.size(), request.data.begin());
+            }
+        }
+        first = last + 1;
+    }
+    return {};
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::writeMany(etl::span<const WriteRequest> requests)
+{
+    WL_TRACE_SPAN(m_tracer, "writeMany");
+
+    if (requests.size() > MANY_REQUESTS_CAPACITY)
+    {
+        for (size_t i = 0; i < requests.size(); i += MANY_REQUESTS_CAPACITY)
+        {
+            if (const auto result = writeMany(requests.subspan(i, std::min(MANY_REQUESTS_CAPACITY, requests.size() - i))); !result.has_value())
+            {
+                return result;
+            }
+        }
+        return {};
+    }
+
+    etl::vector<const WriteRequest*, MANY_REQUESTS_CAPACITY> sortedRequests;
+    for (const auto& request : requests)
+    {
+        if (const auto memoryDescriptor = getMemoryDescriptorWithChecks(request.address, request.data.size()); !memoryDescriptor.has_value())
+        {
+            return etl::unexpected<Error>(memoryDescriptor.error());
+        }
+        sortedRequests.push_back(&request);
+    }
+    std::stable_sort(sortedRequests.begin(), sortedRequests.end(), [](const WriteRequest* a, const WriteRequest* b)
+    {
+        return a->address < b->address;
+    });
+
+    for (size_t i = 1; i < sortedRequests.size(); ++i)
+    {
+        if (sortedRequests.at(i)->address < sortedRequests.at(i - 1)->address + sortedRequests.at(i - 1)->data.size())
+        {
+            // the order of overlapping writes matters
+            return BaseClass::writeMany(requests);
+        }
+    }
+
+    for (size_t first = 0; first < sortedRequests.size();)
+    {
+        const auto memoryDescriptor = getMemoryDescriptorWithChecks(sortedRequests.at(first)->address, sortedRequests.at(first)->data.size()).value();
+
+        auto addressRange = AddressRange::firstAndSize(sortedRequests.at(first)->address, sortedRequests.at(first)->data.size());
+        size_t last = first;
+        while (last + 1 < sortedRequests.size())
+        {
+            const auto nextRange = AddressRange::firstAndSize(sortedRequests.at(last + 1)->address, sortedRequests.at(last + 1)->data.size());
+            const auto mergedRange = AddressRange::firstToLast(addressRange.getFirstAddress(), nextRange.getLastAddress());
+            if (nextRange.getFirstAddress() != uint64_t(addressRange.getLastAddress()) + 1 ||
+                mergedRange.getSize() > COALESCED_DATA_CAPACITY ||
+                !memoryDescriptor.addressRange.contains(mergedRange))
+            {
+                break;
+            }
+            addressRange = mergedRange;
+            ++last;
+        }
+
+        if (first == last)
+        {
+            if (const auto result = writeData(sortedRequests.at(first)->data, addressRange.getFirstAddress()); !result.has_value())
+            {
+                return result;
+            }
+        }
+        else
+        {
+            etl::array<uint8_t, COALESCED_DATA_CAPACITY> data = {};
+            for (size_t i = first; i <= last; ++i)
+            {
+                const auto& request = *sortedRequests.at(i);
+                std::copy(request.data.begin(), request.data.end(), data.begin() + (request.address - addressRange.getFirstAddress()));
+            }
+            if (const auto result = writeData(etl::span<const uint8_t>(data).first(addressRange.getSize()), addressRange.getFirstAddress()); !result.has_value())
+            {
+                return result;
+            }
+        }
+        first = last + 1;
+    }
+    return {};
+}
+
+size_t DeviceInterfaceWEOM::getReadGapLimit(MemoryTypeWEOM type) const
+{
+    // another request costs the headers of the request and the response and the device turnaround time
+    const auto& roundTripEstimator = getRoundTripEstimator(type);
+    const auto turnaroundTime = roundTripEstimator.hasSamples() ? roundTripEstimator.getSmoothedRoundTripTime() : Duration::zero();
+    const auto turnaroundMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(turnaroundTime).count();
+    const auto turnaroundBytes = static_cast<size_t>(turnaroundMicroseconds * getBaudrate() / (BITS_PER_BYTE * 1'000'000));
+    return 2 * TCSIPacket::MINIMUM_PACKET_SIZE + turnaroundBytes;
+}
+
+void DeviceInterfaceWEOM::setTracer(Tracer* tracer)
+{
+#ifdef WL_ENABLE_TRACING
+    m_tracer = tracer;
+#endif
+    if (m_protocolInterface)
+    {
+        m_protocolInterface->setTracer(tracer);
+    }
+}
+
+void DeviceInterfaceWEOM::setPipelineDepth(uint8_t depth)
+{
+    if (m_protocolInterface)
+    {
+        m_protocolInterface->setPipelineDepth(depth);
+    }
+}
+
+uint8_t DeviceInterfaceWEOM::getPipelineDepth() const
+{
+    return m_protocolInterface ? m_protocolInterface->getPipelineDepth() : 1;
+}
+
+void DeviceInterfaceWEOM::setTimeoutLimits(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout)
+{
+    assert(minimumTimeout <= maximumTimeout);
+    m_minimumTimeout = minimumTimeout;
+    m_maximumTimeout = std::max(minimumTimeout, maximumTimeout);
+}
+
+Clock::duration DeviceInterfaceWEOM::getMinimumTimeout() const
+{
+    return m_minimumTimeout;
+}
+
+Clock::duration DeviceInterfaceWEOM::getMaximumTimeout() const
+{
+    return m_maximumTimeout;
+}
+
+Clock::duration DeviceInterfaceWEOM::getResponseTimeout(MemoryTypeWEOM type, size_t requestSize, size_t responseSize) const
+{
+    return getTransmissionTime(requestSize + responseSize) + getRoundTripEstimator(type).getTimeout(m_minimumTimeout, m_maximumTimeout);
+}
+
+const LatencyHistogram& DeviceInterfaceWEOM::Statistics::getLatency(Operation operation, MemoryTypeWEOM memoryType) const
+{
+    return latencies.at(static_cast<size_t>(operation) * 2 + (memoryType == MemoryTypeWEOM::FLASH_MEMORY ? 1 : 0));
+}
+
+LatencyHistogram& DeviceInterfaceWEOM::Statistics::getLatency(Operation operation, MemoryTypeWEOM memoryType)
+{
+    return latencies.at(static_cast<size_t>(operation) * 2 + (memoryType == MemoryTypeWEOM::FLASH_MEMORY ? 1 : 0));
+}
+
+DeviceInterfaceWEOM::Statistics& DeviceInterfaceWEOM::Statistics::operator+=(const Statistics& other)
+{
+    retriesCount += other.retriesCount;
+    busySleepsCount += other.busySleepsCount;
+    busyTime += other.busyTime;
+    errors += other.errors;
+    for (size_t i = 0; i < latencies.size(); ++i)
+    {
+        latencies[i] += other.latencies[i];
+    }
+    return *this;
+}
+
+DeviceInterfaceWEOM::Statistics DeviceInterfaceWEOM::getStatistics() const
+{
+#ifdef WL_ENABLE_STATISTICS
+    return m_statistics;
+#else
+    return {};
+#endif
+}
+
+void DeviceInterfaceWEOM::resetStatistics()
+{
+#ifdef WL_ENABLE_STATISTICS
+    m_statistics = {};
+#endif
+    if (m_protocolInterface)
+    {
+        m_protocolInterface->resetStatistics();
+    }
 }
 
+const ProtocolInterfaceTCSI* DeviceInterfaceWEOM::getProtocolInterface() const
+{
+    return m_protocolInterface.get();
+}
+
+bool DeviceInterfaceWEOM::isBaudrateSupported(uint32_t baudrate) const
+{
+    return m_protocolInterface && m_protocolInterface->isBaudrateSupported(baudrate);
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::setBaudrate(uint32_t baudrate)
+{
+    if (!m_protocolInterface)
+    {
+        return etl::unexpected<Error>(Error::DEVICE__NO_PROTOCOL);
+    }
+    return m_protocolInterface->setBaudrate(baudrate);
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::probeData(etl::span<uint8_t> data, uint32_t address, const Clock::duration& turnaroundTimeout)
+{
+    WL_TRACE_SPAN(m_tracer, "probeData", .address = address, .size = static_cast<uint32_t>(data.size()));
+
+    if (!m_protocolInterface)
+    {
+        return etl::unexpected<Error>(Error::DEVICE__NO_PROTOCOL);
+    }
+    assert(data.size() <= m_protocolInterface->getMaxDataSize());
+
+    const auto timeout = getTransmissionTime(2 * TCSIPacket::MINIMUM_PACKET_SIZE + data.size()) + turnaroundTimeout;
+    const auto result = m_protocolInterface->readData(data, address, timeout);
+    WL_TRACE_SPAN_RESULT(result);
+    return result;
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::probeWrite(etl::span<const uint8_t> data, uint32_t address, const Clock::duration& turnaroundTimeout)
+{
+    WL_TRACE_SPAN(m_tracer, "probeWrite", .address = address, .size = static_cast<uint32_t>(data.size()));
+
+    if (!m_protocolInterface)
+    {
+        return etl::unexpected<Error>(Error::DEVICE__NO_PROTOCOL);
+    }
+    assert(data.size() <= m_protocolInterface->getMaxDataSize());
+
+    const auto timeout = getTransmissionTime(2 * TCSIPacket::MINIMUM_PACKET_SIZE + data.size()) + turnaroundTimeout;
+    const auto result = m_protocolInterface->writeData(data, address, timeout);
+    WL_TRACE_SPAN_RESULT(result);
+    return result;
+}
 
-etl::expected<void, Error> DeviceInterfaceWEOM::writeDataImpl(const etl::span<const uint8_t> data, uint32_t address, const Duration& expectedOperationDuration,
+etl::expected<void, Error> DeviceInterfaceWEOM::writeDataImpl(const etl::span<const uint8_t> data, uint32_t address, MemoryTypeWEOM memoryType,
                                                 const uint32_t maxDataSize, Duration& busyDelayTotal, ErrorWindow& lastErrors)
 {
+    // triggers take far longer than register accesses, they are waited for up to the maximum timeout and kept out of the estimate
+    const bool controlWrite = MemorySpaceWEOM::getRegisterClass(AddressRange::firstAndSize(address, data.size())) == RegisterClassWEOM::CONTROL;
+
     etl::span<const uint8_t> restOfData = data;
     for (uint32_t currentAddress = address; !restOfData.empty(); )
     {
-        const auto dataSize = std::min<uint32_t>(restOfData.size(), maxDataSize);
+        etl::vector<ProtocolInterfaceTCSI::WriteTransfer, ProtocolInterfaceTCSI::MAX_PIPELINE_DEPTH> transfers;
+        etl::span<const uint8_t> windowData = restOfData;
+        for (uint32_t windowAddress = currentAddress; !windowData.empty() && transfers.size() < m_protocolInterface->getPipelineDepth(); )
+        {
+            const auto dataSize = std::min<uint32_t>(windowData.size(), maxDataSize);
+            transfers.push_back(ProtocolInterfaceTCSI::WriteTransfer{windowData.first(dataSize), windowAddress, {}});
+            windowAddress += dataSize;
+            windowData = windowData.last(windowData.size() - dataSize);
+        }
 
-        const auto writeResult = m_protocolInterface->writeData(restOfData.first(dataSize), currentAddress, expectedOperationDuration);
-        lastErrors <<= 1;
-        if (writeResult.has_value())
+        const size_t windowDataSize = restOfData.size() - windowData.size();
+        const size_t requestSize = TCSIPacket::MINIMUM_PACKET_SIZE + transfers.front().data.size();
+        const auto timeout = controlWrite ? getTransmissionTime(requestSize + TCSIPacket::MINIMUM_PACKET_SIZE) + m_maximumTimeout :
+                                            getResponseTimeout(memoryType, requestSize, TCSIPacket::MINIMUM_PACKET_SIZE);
+        const ElapsedTimer timer;
+        if (const auto pipelineResult = m_protocolInterface->writeDataPipelined(transfers, timeout); !pipelineResult.has_value())
         {
-            currentAddress += dataSize;
-            restOfData = restOfData.last(restOfData.size() - dataSize);
+            return pipelineResult;
         }
-        else
+        if (!controlWrite)
         {
-            const auto result = handleErrorResponse(writeResult, lastErrors, busyDelayTotal);
-            if (!result.has_value())
+            updateRoundTripEstimate(memoryType, transfers, windowDataSize, timer.getElapsedTime());
+        }
+
+        for (const auto& transfer : transfers)
+        {
+            lastErrors <<= 1;
+            if (transfer.result.has_value())
             {
-                return result;
+                currentAddress += transfer.data.size();
+                restOfData = restOfData.last(restOfData.size() - transfer.data.size());
+            }
+            else
+            {
+                const auto result = handleErrorResponse(transfer.result, transfer.address, lastErrors, busyDelayTotal);
+                if (!result.has_value())
+                {
+                    return result;
+                }
+                // retry from the first failed transfer
+                break;
             }
         }
     }
@@ -78,7 +445,111 @@ etl::expected<void, Error> DeviceInterfaceWEOM::writeDataImpl(const etl::span<co
     return {};
 }
 
-etl::expected<void, Error> DeviceInterfaceWEOM::readDataImpl(etl::span<uint8_t> data, uint32_t address, uint32_t maxDataSize)
+etl::expected<void, Error> DeviceInterfaceWEOM::writeFlashDataImpl(const etl::span<const uint8_t> data, uint32_t address, const uint32_t maxDataSize,
+                                                                   Duration& busyDelayTotal, ErrorWindow& lastErrors)
+{
+    const auto controlTimeout = getResponseTimeout(MemoryTypeWEOM::FLASH_MEMORY, TCSIPacket::MINIMUM_PACKET_SIZE + 4, TCSIPacket::MINIMUM_PACKET_SIZE);
+    const auto endTimeout = m_maximumTimeout + getTransmissionTime(2 * TCSIPacket::MINIMUM_PACKET_SIZE);
+    const uint32_t endAddress = address + data.size();
+
+    // the whole contiguous block is written in a single burst; the device writes a burst sequentially, so after an error
+    // the burst is ended and a new one starts at the first address not known to be persisted
+    uint32_t currentAddress = address;
+    uint32_t restartAddress = address;
+    size_t restartsCount = 0;
+    while (!data.empty())
+    {
+        const uint32_t burstAddress = currentAddress;
+        auto result = m_protocolInterface->beginFlashBurst(burstAddress, controlTimeout);
+        const bool burstBegun = result.has_value();
+        const bool staleBurst = !burstBegun && result.error() == Error::TCSI__RESPONSE_FLASH_BURST_ERROR;
+        while (result.has_value() && currentAddress < endAddress)
+        {
+            lastErrors <<= 1;
+            const auto dataSize = std::min<uint32_t>(endAddress - currentAddress, maxDataSize);
+            const ProtocolInterfaceTCSI::WriteTransfer transfers[] = {{data.subspan(currentAddress - address, dataSize), currentAddress, {}}};
+            const auto timeout = getResponseTimeout(MemoryTypeWEOM::FLASH_MEMORY, TCSIPacket::MINIMUM_PACKET_SIZE + dataSize, TCSIPacket::MINIMUM_PACKET_SIZE);
+
+            const ElapsedTimer timer;
+            result = m_protocolInterface->writeFlashBurstData(transfers[0].data, currentAddress, timeout);
+            updateRoundTripEstimate(MemoryTypeWEOM::FLASH_MEMORY, etl::span<const ProtocolInterfaceTCSI::WriteTransfer>(transfers), dataSize, timer.getElapsedTime());
+            if (result.has_value())
+            {
+                currentAddress += dataSize;
+            }
+        }
+
+        if (!burstBegun)
+        {
+            if (staleBurst)
+            {
+                // the device still holds a previous burst
+                (void)m_protocolInterface->abortFlashBurst(burstAddress, controlTimeout);
+            }
+        }
+        else if (result.has_value())
+        {
+            result = m_protocolInterface->endFlashBurst(endTimeout);
+            if (result.has_value())
+            {
+                return {};
+            }
+            currentAddress = burstAddress;
+        }
+        else if (m_protocolInterface->isFlashBurstOpened())
+        {
+            // the end persists the data written before the failed write, which may have reached the device and is written again
+            if (!m_protocolInterface->abortFlashBurst(burstAddress, controlTimeout).has_value())
+            {
+                currentAddress = burstAddress;
+            }
+        }
+        else
+        {
+            // the device discarded the burst
+            currentAddress = burstAddress;
+        }
+
+        if (m_protocolInterface->isFlashBurstOpened())
+        {
+            // the end failed without an answer, nothing of the burst is known to be persisted
+            (void)m_protocolInterface->abortFlashBurst(burstAddress, controlTimeout);
+            currentAddress = burstAddress;
+        }
+
+        lastErrors <<= 1;
+        if (const auto errorResult = handleErrorResponse(result, currentAddress, lastErrors, busyDelayTotal); !errorResult.has_value())
+        {
+            return errorResult;
+        }
+
+        // the error window alone does not stop a device rejecting every burst end, the successful writes shift the failures out
+        if (currentAddress > restartAddress)
+        {
+            restartAddress = currentAddress;
+            restartsCount = 0;
+        }
+        if (++restartsCount > MAX_FLASH_BURST_RESTARTS)
+        {
+            WL_LOG(LogLevel::FAILURE, "Flash burst failed repeatedly", .error = result.error(), .address = currentAddress);
+            return etl::unexpected<Error>(Error::TCSI__RESPONSE_FLASH_BURST_ERROR);
+        }
+    }
+    return {};
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::readDataImpl(etl::span<uint8_t> data, uint32_t address, MemoryTypeWEOM memoryType, uint32_t maxDataSize)
+{
+    WL_TRACE_SPAN(m_tracer, "readData", .address = address, .size = static_cast<uint32_t>(data.size()));
+
+    const auto startTime = getStatisticsTime();
+    const auto result = readDataWithRetries(data, address, memoryType, maxDataSize);
+    countOperation(Operation::READ, memoryType, startTime, result);
+    WL_TRACE_SPAN_RESULT(result);
+    return result;
+}
+
+etl::expected<void, Error> DeviceInterfaceWEOM::readDataWithRetries(etl::span<uint8_t> data, uint32_t address, MemoryTypeWEOM memoryType, uint32_t maxDataSize)
 {
     Duration busyDelayTotal = std::chrono::milliseconds(0);
     ErrorWindow lastErrors;
@@ -86,22 +557,42 @@ etl::expected<void, Error> DeviceInterfaceWEOM::readDataImpl(etl::span<uint8_t>
     etl::span<uint8_t> restOfData = data;
     for (uint32_t currentAddress = address; !restOfData.empty(); )
     {
-        const auto addressRange = AddressRange::firstAndSize(currentAddress, std::min<uint32_t>(restOfData.size(), maxDataSize));
+        etl::vector<ProtocolInterfaceTCSI::ReadTransfer, ProtocolInterfaceTCSI::MAX_PIPELINE_DEPTH> transfers;
+        etl::span<uint8_t> windowData = restOfData;
+        for (uint32_t windowAddress = currentAddress; !windowData.empty() && transfers.size() < m_protocolInterface->getPipelineDepth(); )
+        {
+            const auto addressRange = AddressRange::firstAndSize(windowAddress, std::min<uint32_t>(windowData.size(), maxDataSize));
+            transfers.push_back(ProtocolInterfaceTCSI::ReadTransfer{windowData.first(addressRange.getSize()), addressRange.getFirstAddress(), {}});
+            windowAddress += addressRange.getSize();
+            windowData = windowData.last(windowData.size() - addressRange.getSize());
+        }
 
-        const auto dataRange = restOfData.first(addressRange.getSize());
-        const auto readResult = m_protocolInterface->readData(dataRange, addressRange.getFirstAddress(), TIMEOUT_DEFAULT);
-        lastErrors <<= 1;
-        if (readResult.has_value())
+        const size_t windowDataSize = restOfData.size() - windowData.size();
+        const auto timeout = getResponseTimeout(memoryType, TCSIPacket::MINIMUM_PACKET_SIZE, TCSIPacket::MINIMUM_PACKET_SIZE + transfers.front().data.size());
+        const ElapsedTimer timer;
+        if (const auto pipelineResult = m_protocolInterface->readDataPipelined(transfers, timeout); !pipelineResult.has_value())
         {
-            currentAddress += addressRange.getSize();
-            restOfData = restOfData.last(restOfData.size() - addressRange.getSize());
+            return pipelineResult;
         }
-        else
+        updateRoundTripEstimate(memoryType, transfers, windowDataSize, timer.getElapsedTime());
+
+        for (const auto& transfer : transfers)
         {
-            const auto result = handleErrorResponse(readResult, lastErrors, busyDelayTotal);
-            if (!result.has_value())
+            lastErrors <<= 1;
+            if (transfer.result.has_value())
             {
-                return result;
+                currentAddress += transfer.data.size();
+                restOfData = restOfData.last(restOfData.size() - transfer.data.size());
+            }
+            else
+            {
+                const auto result = handleErrorResponse(transfer.result, transfer.address, lastErrors, busyDelayTotal);
+                if (!result.has_value())
+                {
+                    return result;
+                }
+                // retry from the first failed transfer
+                break;
             }
         }
     }
@@ -109,7 +600,8 @@ etl::expected<void, Error> DeviceInterfaceWEOM::readDataImpl(etl::span<uint8_t>
     return {};
 }
 
-etl::expected<void, Error> DeviceInterfaceWEOM::handleErrorResponse(etl::expected<void, Error> operationResult, ErrorWindow& lastErrors, Duration& busyDelayTotal)
+etl::expected<void, Error> DeviceInterfaceWEOM::handleErrorResponse(etl::expected<void, Error> operationResult, [[maybe_unused]] uint32_t address,
+                                                                    ErrorWindow& lastErrors, Duration& busyDelayTotal)
 {
     if (!operationResult.has_value())
     {
@@ -119,18 +611,22 @@ etl::expected<void, Error> DeviceInterfaceWEOM::handleErrorResponse(etl::expecte
             operationResult.error() == Error::TCSI__INVALID_STATUS_OR_COMMAND ||
             operationResult.error() == Error::TCSI__INVALID_CHECKSUM ||
             operationResult.error() == Error::TCSI__INVALID_RESPONSE_ADDRESS ||
-            operationResult.error() == Error::TCSI__RESPONSE_STATUS_ERROR)
+            operationResult.error() == Error::TCSI__RESPONSE_STATUS_ERROR ||
+            operationResult.error() == Error::TCSI__RESPONSE_FLASH_BURST_ERROR)
         {
             lastErrors.set(0, 1);
-            char errMsg[200];
-            sprintf(errMsg, "Device interface error %d", static_cast<int>(operationResult.error()));
-            Error::log(errMsg);
             if (lastErrors.count() <= MAX_ERRORS_IN_WINDOW)
             {
+                WL_LOG(LogLevel::WARNING, "Transfer failed, retrying", .error = operationResult.error(), .address = address);
+                WL_TRACE_INSTANT(m_tracer, "retry", .error = operationResult.error());
+#ifdef WL_ENABLE_STATISTICS
+                ++m_statistics.retriesCount;
+#endif
                 return {};
             }
             else
             {
+                WL_LOG(LogLevel::FAILURE, "Too many failed transfers, assuming disconnected", .error = operationResult.error(), .address = address);
                 return etl::unexpected<Error>(Error::DEVICE__DISCONNECTED);
             }
         }
@@ -140,11 +636,22 @@ etl::expected<void, Error> DeviceInterfaceWEOM::handleErrorResponse(etl::expecte
             if (busyDelayTotal < BUSY_DEVICE_TIMEOUT)
             {
                 assert(m_sleepFunction);
-                m_sleepFunction(BUSY_DEVICE_DELAY);
+                {
+                    WL_TRACE_SPAN(m_tracer, "busy sleep", .error = operationResult.error());
+                    m_sleepFunction(BUSY_DEVICE_DELAY);
+                }
+                WL_LOG(LogLevel::VERBOSE, "Device busy, retrying", .error = operationResult.error(), .address = address);
+                WL_TRACE_INSTANT(m_tracer, "retry", .error = operationResult.error());
+#ifdef WL_ENABLE_STATISTICS
+                ++m_statistics.retriesCount;
+                ++m_statistics.busySleepsCount;
+                m_statistics.busyTime += BUSY_DEVICE_DELAY;
+#endif
                 return {};
             }
             else
             {
+                WL_LOG(LogLevel::FAILURE, "Device busy for too long", .error = operationResult.error(), .address = address);
                 return etl::unexpected<Error>(Error::DEVICE__BUSY);
             }
         }
@@ -190,6 +697,55 @@ etl::expected<MemoryDescriptorWEOM, Error> DeviceInterfaceWEOM::getMemoryDescrip
     return memoryDescriptor;
 }
 
+template<class Transfers>
+void DeviceInterfaceWEOM::updateRoundTripEstimate(MemoryTypeWEOM memoryType, const Transfers& transfers, size_t transferredSize, const Duration& elapsedTime)
+{
+    // Karn's rule - a window with a lost or rejected response says nothing reliable about the turnaround time
+    bool allSucceeded = true;
+    for (const auto& transfer : transfers)
+    {
+        if (!transfer.result.has_value())
+        {
+            if (transfer.result.error() == Error::DATALINK__TIMEOUT)
+            {
+                getRoundTripEstimator(memoryType).addTimeout(m_minimumTimeout, m_maximumTimeout);
+                return;
+            }
+            allSucceeded = false;
+        }
+    }
+
+    // in a pipelined window the turnarounds overlap with the other transfers on the wire, only a single transfer measures one
+    if (allSucceeded && transfers.size() == 1)
+    {
+        const size_t packetsSize = 2 * TCSIPacket::MINIMUM_PACKET_SIZE + transferredSize;
+        getRoundTripEstimator(memoryType).addSample(elapsedTime - getTransmissionTime(packetsSize));
+    }
+}
+
+RoundTripEstimator& DeviceInterfaceWEOM::getRoundTripEstimator(MemoryTypeWEOM memoryType)
+{
+    return m_roundTripEstimators.at(memoryType == MemoryTypeWEOM::FLASH_MEMORY ? 1 : 0);
+}
+
+const RoundTripEstimator& DeviceInterfaceWEOM::getRoundTripEstimator(MemoryTypeWEOM memoryType) const
+{
+    return m_roundTripEstimators.at(memoryType == MemoryTypeWEOM::FLASH_MEMORY ? 1 : 0);
+}
+
+DeviceInterfaceWEOM::Duration DeviceInterfaceWEOM::getTransmissionTime(size_t size) const
+{
+    const uint32_t baudrate = getBaudrate();
+    const auto bits = static_cast<int64_t>(size) * BITS_PER_BYTE;
+    return std::chrono::duration_cast<Duration>(std::chrono::microseconds((bits * 1'000'000 + baudrate - 1) / baudrate));
+}
+
+uint32_t DeviceInterfaceWEOM::getBaudrate() const
+{
+    const uint32_t reportedBaudrate = m_protocolInterface ? m_protocolInterface->getBaudrate() : 0;
+    return reportedBaudrate != 0 ? reportedBaudrate : BAUDRATE_DEFAULT;
+}
+
 uint32_t DeviceInterfaceWEOM::getMaxDataSize(const MemoryDescriptorWEOM& memoryDescriptor) const
 {
     const auto protocolMaxDataSize = (m_protocolInterface->getMaxDataSize() / memoryDescriptor.minimumDataSize) * memoryDescriptor.minimumDataSize;
@@ -197,4 +753,20 @@ uint32_t DeviceInterfaceWEOM::getMaxDataSize(const MemoryDescriptorWEOM& memoryD
     return std::min(memoryDescriptor.maximumDataSize, protocolMaxDataSize);
 }
 
+void DeviceInterfaceWEOM::countOperation(Operation operation, MemoryTypeWEOM memoryType, const Clock::time_point& startTime, const etl::expected<void, Error>& result)
+{
+#ifdef WL_ENABLE_STATISTICS
+    m_statistics.getLatency(operation, memoryType).add(Clock::now() - startTime);
+    if (!result.has_value())
+    {
+        m_statistics.errors.add(result.error());
+    }
+#else
+    (void)operation;
+    (void)memoryType;
+    (void)startTime;
+    (void)result;
+#endif
+}
+
 } // namespace wl
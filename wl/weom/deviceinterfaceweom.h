@@ -3,9 +3,13 @@
 
 #include "wl/communication/ideviceinterface.h"
 #include "wl/weom/memoryspaceweom.h"
+#include "wl/misc/roundtripestimator.h"
+#include "wl/misc/statistics.h"
+#include "wl/misc/tracer.h"
 #include "wl/error.h"
 #include "wl/time.h"
 
+#include <etl/array.h>
 #include <etl/mutex.h>
 #include <etl/expected.h>
 #include <etl/span.h>
@@ -64,21 +68,220 @@ public:
      */
     [[nodiscard]] virtual etl::expected<void, Error> writeData(const etl::span<const uint8_t> data, uint32_t address) override;
 
+    /**
+     * @brief Reads several address ranges, nearby ones in a single transfer.
+     *
+     * Requests are sorted by address and merged when they overlap, are adjacent or the gap between them costs less
+     * on the wire than another request (see getReadGapLimit()). A gap in registers is read only when it is covered by
+     * known registers (see MemorySpaceWEOM::isReadable()). A merged read stays within one memory descriptor and
+     * one packet, its data are copied back to the buffers of the requests.
+     * @param requests The reads, each has to meet the alignment and size granularity of its memory.
+     * @return An `etl::expected<void, Error>` indicating success or the first error.
+     */
+    [[nodiscard]] virtual etl::expected<void, Error> readMany(etl::span<const ReadRequest> requests) override;
+
+    /**
+     * @brief Writes several address ranges, adjacent ones in a single transfer.
+     *
+     * Requests are sorted by address and the adjacent ones within one memory descriptor are merged.
+     * If any requests overlap, all of them are written one by one in the given order.
+     * @param requests The writes, each has to meet the alignment and size granularity of its memory.
+     * @return An `etl::expected<void, Error>` indicating success or the first error.
+     */
+    [[nodiscard]] virtual etl::expected<void, Error> writeMany(etl::span<const WriteRequest> requests) override;
+
+    /**
+     * @brief Retrieves the largest gap between two requests that readMany() reads through instead of sending another request.
+     * @param type Memory type the requests access.
+     * @return Size of the packet headers of a request and its response plus the bytes transferable during the estimated device turnaround time.
+     */
+    size_t getReadGapLimit(MemoryTypeWEOM type) const;
+
+    /**
+     * @brief Sets the tracer receiving spans of the reads, writes, retries and busy sleeps, and of the protocol interface requests.
+     *
+     * Has effect only when built with `WL_ENABLE_TRACING`.
+     * @param tracer The tracer, has to outlive this instance, or nullptr to stop tracing.
+     * @see ProtocolInterfaceTCSI::setTracer
+     */
+    void setTracer(Tracer* tracer);
+
+    /**
+     * @brief Sets how many requests may be in flight when a transfer is split into several packets.
+     * @param depth Pipeline depth (1 - ProtocolInterfaceTCSI::MAX_PIPELINE_DEPTH).
+     * @see ProtocolInterfaceTCSI::setPipelineDepth
+     */
+    void setPipelineDepth(uint8_t depth);
+
+    /**
+     * @brief Retrieves the current pipeline depth.
+     * @return Number of requests kept in flight.
+     * @see ProtocolInterfaceTCSI::getPipelineDepth
+     */
+    uint8_t getPipelineDepth() const;
+
+    /**
+     * @brief Sets the limits of the time the device may take to respond to a request.
+     *
+     * Response timeouts are derived from the device turnaround time measured on transfers that are not pipelined,
+     * kept separately for each memory type, plus the time the request and the response take on the wire at the data
+     * link baud rate. The turnaround part is clamped to the limits - the maximum is also used until the first response
+     * is measured. Each timeout doubles
+     * the turnaround part up to the maximum until the next response is measured. Writes of trigger and status registers
+     * always wait up to the maximum and are not measured.
+     * @param minimumTimeout Lower limit of the turnaround part of the timeout.
+     * @param maximumTimeout Upper limit of the turnaround part of the timeout, must not be lower than minimumTimeout.
+     */
+    void setTimeoutLimits(const Clock::duration& minimumTimeout, const Clock::duration& maximumTimeout);
+
+    /**
+     * @brief Retrieves the lower limit of the turnaround part of response timeouts.
+     * @return Minimum timeout.
+     */
+    Clock::duration getMinimumTimeout() const;
+
+    /**
+     * @brief Retrieves the upper limit of the turnaround part of response timeouts.
+     * @return Maximum timeout.
+     */
+    Clock::duration getMaximumTimeout() const;
+
+    /**
+     * @brief Retrieves the timeout currently used when waiting for a response.
+     * @param type Memory type the request accesses.
+     * @param requestSize Size of the request packet in bytes.
+     * @param responseSize Size of the response packet in bytes.
+     * @return Time on the wire plus the estimated device turnaround time.
+     */
+    Clock::duration getResponseTimeout(MemoryTypeWEOM type, size_t requestSize, size_t responseSize) const;
+
+    static constexpr Clock::duration MINIMUM_TIMEOUT_DEFAULT = std::chrono::milliseconds(20);  ///< Default lower limit of the turnaround part of timeouts.
+    static constexpr Clock::duration MAXIMUM_TIMEOUT_DEFAULT = std::chrono::milliseconds(1'000); ///< Default upper limit of the turnaround part of timeouts.
+
+    /**
+     * @brief Enumeration of operations measured by Statistics.
+     */
+    enum class Operation : uint8_t
+    {
+        READ,  ///< readData() and each transfer of readMany()
+        WRITE, ///< writeData() and each transfer of writeMany()
+    };
+
+    /**
+     * @struct Statistics
+     * @brief Counters of reads and writes, collected only when built with `WL_ENABLE_STATISTICS` (see STATISTICS_ENABLED).
+     */
+    struct Statistics
+    {
+        uint32_t retriesCount {0};                 ///< Transfers repeated after an error or a busy response.
+        uint32_t busySleepsCount {0};              ///< Waits for a busy device.
+        Clock::duration busyTime {0};              ///< Total time of the waits for a busy device.
+        ErrorCounts errors;                        ///< Failed operations by the error returned to the caller.
+        etl::array<LatencyHistogram, 4> latencies; ///< Durations of operations including retries, see getLatency().
+
+        /**
+         * @brief Retrieves the durations of an operation on a memory type.
+         * @param operation The operation.
+         * @param memoryType The memory type.
+         * @return The histogram.
+         */
+        const LatencyHistogram& getLatency(Operation operation, MemoryTypeWEOM memoryType) const;
+
+        /**
+         * @copydoc getLatency(Operation, MemoryTypeWEOM) const
+         */
+        LatencyHistogram& getLatency(Operation operation, MemoryTypeWEOM memoryType);
+
+        /**
+         * @brief Adds counters of another instance.
+         * @param other Counters to add.
+         * @return Reference to this instance.
+         */
+        Statistics& operator+=(const Statistics& other);
+    };
+
+    /**
+     * @brief Retrieves the counters collected since construction or resetStatistics().
+     * @return Copy of the counters, zero unless built with `WL_ENABLE_STATISTICS`.
+     */
+    Statistics getStatistics() const;
+
+    /**
+     * @brief Sets all counters to zero, including those of the protocol interface.
+     */
+    void resetStatistics();
+
+    /**
+     * @brief Retrieves the protocol interface used by this device interface.
+     * @return Pointer to the protocol interface, nullptr if not set.
+     */
+    const ProtocolInterfaceTCSI* getProtocolInterface() const;
+
+    /**
+     * @brief Checks if the data link can switch to a baud rate.
+     * @param baudrate Baud rate in bits per second.
+     * @return True if supported, false otherwise.
+     * @see IDataLinkInterface::isBaudrateSupported
+     */
+    bool isBaudrateSupported(uint32_t baudrate) const;
+
+    /**
+     * @brief Switches the data link to a baud rate, response timeouts follow the new line speed.
+     * @param baudrate Baud rate in bits per second.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     * @see IDataLinkInterface::setBaudrate
+     */
+    [[nodiscard]] etl::expected<void, Error> setBaudrate(uint32_t baudrate);
+
+    /**
+     * @brief Reads data in a single request without retries, e.g. to find out whether the device responds at all.
+     * @param data A span to store the read data, it has to fit a single request.
+     * @param address The address to read from.
+     * @param turnaroundTimeout Time the device may take to start responding, the time on the wire is added.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> probeData(etl::span<uint8_t> data, uint32_t address, const Clock::duration& turnaroundTimeout);
+
+    /**
+     * @brief Writes data in a single request without retries, e.g. when the device may not answer at the current speed.
+     * @param data The data to write, it has to fit a single request.
+     * @param address The address to write to.
+     * @param turnaroundTimeout Time the device may take to start responding, the time on the wire is added.
+     * @return An `etl::expected<void, Error>` indicating success or error.
+     */
+    [[nodiscard]] etl::expected<void, Error> probeWrite(etl::span<const uint8_t> data, uint32_t address, const Clock::duration& turnaroundTimeout);
 
 private:
     using Duration = std::chrono::steady_clock::duration;
     using ErrorWindow = std::bitset<8>;
     static constexpr size_t MAX_ERRORS_IN_WINDOW = 4;
+    static constexpr size_t MAX_FLASH_BURST_RESTARTS = 3; // bursts started again at the same address before giving up
 
-    [[nodiscard]] etl::expected<void, Error> writeDataImpl(const etl::span<const uint8_t> data, uint32_t address, const Duration& expectedOperationDuration,
+    [[nodiscard]] etl::expected<void, Error> writeDataImpl(const etl::span<const uint8_t> data, uint32_t address, MemoryTypeWEOM memoryType,
                                            const uint32_t maxDataSize, Duration& busyDelayTotal, ErrorWindow& lastErrors);
-    [[nodiscard]] etl::expected<void, Error> readDataImpl(etl::span<uint8_t> data, uint32_t address, uint32_t maxDataSize);
+    [[nodiscard]] etl::expected<void, Error> writeFlashDataImpl(const etl::span<const uint8_t> data, uint32_t address, const uint32_t maxDataSize,
+                                                                Duration& busyDelayTotal, ErrorWindow& lastErrors);
+    [[nodiscard]] etl::expected<void, Error> readDataImpl(etl::span<uint8_t> data, uint32_t address, MemoryTypeWEOM memoryType, uint32_t maxDataSize);
+    [[nodiscard]] etl::expected<void, Error> readDataWithRetries(etl::span<uint8_t> data, uint32_t address, MemoryTypeWEOM memoryType, uint32_t maxDataSize);
 
-    [[nodiscard]] etl::expected<void, Error> handleErrorResponse(etl::expected<void, Error> operationResult, ErrorWindow& lastErrors, Duration& busyDelayTotal);
+    [[nodiscard]] etl::expected<void, Error> handleErrorResponse(etl::expected<void, Error> operationResult, uint32_t address, ErrorWindow& lastErrors, Duration& busyDelayTotal);
     [[nodiscard]] etl::expected<MemoryDescriptorWEOM, Error> getMemoryDescriptorWithChecks(uint32_t address, etl::optional<size_t> dataSize) const;
     uint32_t getMaxDataSize(const MemoryDescriptorWEOM& memoryDescriptor) const;
 
-    static constexpr Duration TIMEOUT_DEFAULT = std::chrono::milliseconds(1'000);
+    void countOperation(Operation operation, MemoryTypeWEOM memoryType, const Clock::time_point& startTime, const etl::expected<void, Error>& result);
+
+    template<class Transfers>
+    void updateRoundTripEstimate(MemoryTypeWEOM memoryType, const Transfers& transfers, size_t transferredSize, const Duration& elapsedTime);
+    RoundTripEstimator& getRoundTripEstimator(MemoryTypeWEOM memoryType);
+    const RoundTripEstimator& getRoundTripEstimator(MemoryTypeWEOM memoryType) const;
+    Duration getTransmissionTime(size_t size) const;
+    uint32_t getBaudrate() const;
+
+    static constexpr uint32_t BAUDRATE_DEFAULT = 115'200;
+    static constexpr uint32_t BITS_PER_BYTE = 10; // 8 data bits, start and stop bit
+
+    static constexpr size_t MANY_REQUESTS_CAPACITY = 64; // readMany() and writeMany() plan larger sets in chunks
+    static constexpr size_t COALESCED_DATA_CAPACITY = 256;
 
     static constexpr Duration BUSY_DEVICE_DELAY = std::chrono::milliseconds(500);
     static constexpr Duration BUSY_DEVICE_TIMEOUT = std::chrono::milliseconds(10'000);
@@ -87,6 +290,17 @@ private:
 
     MemorySpaceWEOM m_memorySpace;
     SleepFunction m_sleepFunction;
+
+    etl::array<RoundTripEstimator, 2> m_roundTripEstimators;
+    Duration m_minimumTimeout {MINIMUM_TIMEOUT_DEFAULT};
+    Duration m_maximumTimeout {MAXIMUM_TIMEOUT_DEFAULT};
+
+#ifdef WL_ENABLE_STATISTICS
+    Statistics m_statistics;
+#endif
+#ifdef WL_ENABLE_TRACING
+    Tracer* m_tracer {nullptr};
+#endif
 };
 
 } // namespace wl
@@ -1,5 +1,7 @@
 #include "wl/weom/memoryspaceweom.h"
 
+#include <etl/algorithm.h>
+
 
 namespace wl {
 
@@ -30,19 +32,106 @@ const etl::ivector<MemoryDescriptorWEOM>& MemorySpaceWEOM::getMemoryDescriptors(
 MemorySpaceWEOM MemorySpaceWEOM::getDeviceSpace()
 {
     etl::vector<MemoryDescriptorWEOM, 2> memoryDescriptors = {
-        MemoryDescriptorWEOM{CONFIGURATION_REGISTERS, MemoryTypeWEOM::REGISTERS_CONFIGURATION},
-        MemoryDescriptorWEOM{FLASH_MEMORY, MemoryTypeWEOM::FLASH_MEMORY},
+        MemoryDescriptorWEOM{CONFIGURATION_REGISTERS, MemoryTypeWEOM::REGISTERS_CONFIGURATION, REGISTERS_MINIMUM_DATA_SIZE, REGISTERS_MAXIMUM_DATA_SIZE},
+        MemoryDescriptorWEOM{FLASH_MEMORY, MemoryTypeWEOM::FLASH_MEMORY, FLASH_MINIMUM_DATA_SIZE, FLASH_MAXIMUM_DATA_SIZE},
     };
     return MemorySpaceWEOM(memoryDescriptors);
 
 }
 
+RegisterClassWEOM MemorySpaceWEOM::getRegisterClass(const AddressRange& addressRange)
+{
+    struct ClassifiedRange
+    {
+        AddressRange addressRange;
+        RegisterClassWEOM registerClass;
+    };
+
+    // registers not listed are configuration
+    static constexpr ClassifiedRange CLASSIFIED_RANGES[] = {
+        {DEVICE_IDENTIFICATOR, RegisterClassWEOM::IDENTIFICATION},
+        {TRIGGER, RegisterClassWEOM::CONTROL},
+        {STATUS, RegisterClassWEOM::CONTROL},
+        {MAIN_FIRMWARE_VERSION, RegisterClassWEOM::IDENTIFICATION},
+        {SHUTTER_TEMPERATURE, RegisterClassWEOM::TELEMETRY},
+        {SERIAL_NUMBER_CURRENT, RegisterClassWEOM::IDENTIFICATION},
+        {ARTICLE_NUMBER_CURRENT, RegisterClassWEOM::IDENTIFICATION},
+        {SHUTTER_COUNTER, RegisterClassWEOM::TELEMETRY},
+        {TIME_FROM_LAST_NUC_OFFSET_UPDATE, RegisterClassWEOM::TELEMETRY},
+        {INTERNAL_SHUTTER_POSITION, RegisterClassWEOM::TELEMETRY},
+        {FRAME_BLOCK_MEDIAN_CONBRIGHT, RegisterClassWEOM::TELEMETRY},
+        {ATTRIBUTE_ADDRESS, RegisterClassWEOM::CONTROL}, // changes with each write of SELECTED_ATTRIBUTE_AND_PRESET_INDEX
+        {PALETTES_REGISTERS, RegisterClassWEOM::IDENTIFICATION},
+    };
+
+    // a range not covered by a single classified range contains some configuration registers
+    RegisterClassWEOM registerClass = RegisterClassWEOM::CONFIGURATION;
+    for (const auto& classifiedRange : CLASSIFIED_RANGES)
+    {
+        if (classifiedRange.addressRange.contains(addressRange))
+        {
+            registerClass = classifiedRange.registerClass;
+            break;
+        }
+    }
+
+    for (const auto& classifiedRange : CLASSIFIED_RANGES)
+    {
+        if (classifiedRange.addressRange.overlaps(addressRange))
+        {
+            registerClass = etl::max(registerClass, classifiedRange.registerClass);
+        }
+    }
+    return registerClass;
+}
+
+bool MemorySpaceWEOM::isReadable(const AddressRange& addressRange)
+{
+    // known registers merged into contiguous ranges
+    static constexpr AddressRange READABLE_RANGES[] = {
+        AddressRange::firstToLast(DEVICE_IDENTIFICATOR.getFirstAddress(), TRIGGER.getLastAddress()),
+        STATUS,
+        MAIN_FIRMWARE_VERSION,
+        AddressRange::firstToLast(SHUTTER_TEMPERATURE.getFirstAddress(), ARTICLE_NUMBER_CURRENT.getLastAddress()),
+        AddressRange::firstToLast(LED_R_BRIGHTNESS.getFirstAddress(), LED_B_BRIGHTNESS.getLastAddress()),
+        AddressRange::firstToLast(TRIGGER_MODE.getFirstAddress(), AUX_PIN_2.getLastAddress()),
+        AddressRange::firstToLast(PALETTE_INDEX_CURRENT.getFirstAddress(), TEST_PATTERN.getLastAddress()),
+        AddressRange::firstToLast(RETICLE_TYPE.getFirstAddress(), RETICLE_POSITION_Y.getLastAddress()),
+        AddressRange::firstToLast(SHUTTER_COUNTER.getFirstAddress(), NUC_UPDATE_MODE_CURRENT.getLastAddress()),
+        INTERNAL_SHUTTER_POSITION,
+        AddressRange::firstToLast(NUC_MAX_PERIOD_CURRENT.getFirstAddress(), NUC_ADAPTIVE_THRESHOLD_CURRENT.getLastAddress()),
+        UART_BAUDRATE_CURRENT,
+        AddressRange::firstToLast(TIME_DOMAIN_AVERAGE_CURRENT.getFirstAddress(), SPATIAL_MEDIAN_FILTER_ENABLE_CURRENT.getLastAddress()),
+        AddressRange::firstToLast(LINEAR_GAIN_WEIGHT.getFirstAddress(), DAMPING_FACTOR.getLastAddress()),
+        AddressRange::firstToLast(SELECTED_PRESET_INDEX.getFirstAddress(), CURRENT_PRESET_ID.getLastAddress()),
+        AddressRange::firstToLast(getPaletteNameAddressRange(0).getFirstAddress(),
+                                  getPaletteNameAddressRange(PALETTES_FACTORY_MAX_COUNT + PALETTES_USER_MAX_COUNT - 1).getLastAddress()),
+    };
+
+    for (const auto& readableRange : READABLE_RANGES)
+    {
+        if (readableRange.contains(addressRange))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 MemoryDescriptorWEOM::MemoryDescriptorWEOM(const AddressRange& addressRange, MemoryTypeWEOM type) :
+    MemoryDescriptorWEOM(addressRange, type, getMinimumDataSize(type), getMaximumDataSize(type))
+{
+}
+
+MemoryDescriptorWEOM::MemoryDescriptorWEOM(const AddressRange& addressRange, MemoryTypeWEOM type, uint32_t minimumDataSize, uint32_t maximumDataSize) :
     addressRange(addressRange),
     type(type),
-    minimumDataSize(getMinimumDataSize(type)),
-    maximumDataSize(getMaximumDataSize(type))
+    minimumDataSize(minimumDataSize),
+    maximumDataSize(maximumDataSize)
 {
+    assert(minimumDataSize > 0);
+    assert(maximumDataSize >= minimumDataSize);
+    assert(maximumDataSize % minimumDataSize == 0);
 }
 
 uint32_t MemoryDescriptorWEOM::getMinimumDataSize(MemoryTypeWEOM type)
@@ -50,8 +139,9 @@ uint32_t MemoryDescriptorWEOM::getMinimumDataSize(MemoryTypeWEOM type)
     switch (type)
     {
     case MemoryTypeWEOM::REGISTERS_CONFIGURATION:
+        return MemorySpaceWEOM::REGISTERS_MINIMUM_DATA_SIZE;
     case MemoryTypeWEOM::FLASH_MEMORY:
-        return 4;
+        return MemorySpaceWEOM::FLASH_MINIMUM_DATA_SIZE;
     }
     assert(false);
     return 0;
@@ -62,9 +152,9 @@ uint32_t MemoryDescriptorWEOM::getMaximumDataSize(MemoryTypeWEOM type)
     switch (type)
     {
     case MemoryTypeWEOM::REGISTERS_CONFIGURATION:
+        return MemorySpaceWEOM::REGISTERS_MAXIMUM_DATA_SIZE;
     case MemoryTypeWEOM::FLASH_MEMORY:
-        return 4;
-
+        return MemorySpaceWEOM::FLASH_MAXIMUM_DATA_SIZE;
     }
     assert(false);
     return 0;
@@ -19,6 +19,19 @@ namespace wl
         FLASH_MEMORY = 1 << 1,
     };
 
+    /**
+     * @brief Enumeration classifying configuration registers by how their content may change.
+     *
+     * Ordered from the most stable to the most volatile class.
+     */
+    enum class RegisterClassWEOM
+    {
+        IDENTIFICATION, ///< Values fixed for the connected device (identificator, firmware version, serial number...)
+        CONFIGURATION,  ///< Settings changed by writes, triggers (e.g. preset selection) or the device itself (see Status)
+        TELEMETRY,      ///< Measured values changing on their own (temperatures, counters...)
+        CONTROL,        ///< Trigger and status registers
+    };
+
     /**
      * @class MemoryDescriptorWEOM
      * @headerfile memoryspaceweom.h wl/weom/memoryspaceweom.h
@@ -45,6 +58,15 @@ namespace wl
          */
         MemoryDescriptorWEOM(const AddressRange &addressRange, MemoryTypeWEOM type);
 
+        /**
+         * @brief Constructs a memory descriptor with explicit data size constraints.
+         * @param addressRange The address range for the memory segment.
+         * @param type The type of memory.
+         * @param minimumDataSize Minimum (and alignment) data size of a single transfer in bytes.
+         * @param maximumDataSize Maximum data size of a single transfer in bytes.
+         */
+        MemoryDescriptorWEOM(const AddressRange &addressRange, MemoryTypeWEOM type, uint32_t minimumDataSize, uint32_t maximumDataSize);
+
         /**
          * @brief Gets the minimum data size for a specified memory type.
          * @param type The memory type.
@@ -90,11 +112,34 @@ namespace wl
          */
         static MemorySpaceWEOM getDeviceSpace();
 
+        /**
+         * @brief Retrieves the class of configuration registers in the address range.
+         * @param addressRange The address range to classify.
+         * @return The most volatile class of the registers overlapping the address range.
+         */
+        static RegisterClassWEOM getRegisterClass(const AddressRange &addressRange);
+
+        /**
+         * @brief Tells whether every address in the range belongs to a known readable register.
+         *
+         * The device answers reads of unmapped addresses with an error status, so reads may only be widened over mapped registers.
+         * @param addressRange The address range to check.
+         * @return True if the whole range is covered by known readable registers.
+         */
+        static bool isReadable(const AddressRange &addressRange);
+
         static constexpr AddressRange CONFIGURATION_REGISTERS = AddressRange::firstToLast(0x00000000, 0x300040FF); ///< Address range of configuration registers
         static constexpr AddressRange FLASH_MEMORY = AddressRange::firstToLast(0xD0000000, 0xDFFFFFFF);            ///< Address range of flash memory
         static constexpr uint32_t ADDRESS_FLASH_REGISTERS_START = FLASH_MEMORY.getFirstAddress() + 0x00800000;     ///< Starting address of flash registers
 
+        static constexpr uint32_t REGISTERS_MINIMUM_DATA_SIZE = 4;   ///< Register access granularity (and address alignment) of configuration registers
+        static constexpr uint32_t REGISTERS_MAXIMUM_DATA_SIZE = 252; ///< Largest configuration registers transfer in one TCSI packet (multiple of 4 fitting the 1B count)
+        static constexpr uint32_t FLASH_MINIMUM_DATA_SIZE = 4;       ///< Access granularity (and address alignment) of flash memory
+        static constexpr uint32_t FLASH_MAXIMUM_DATA_SIZE = 252;     ///< Largest flash memory transfer in one TCSI packet (multiple of 4 fitting the 1B count)
+
         // Control - 0x00xx
+        static constexpr AddressRange CONTROL_REGISTERS = AddressRange::firstToLast(0x0000, 0x00FF); ///< Address range of control registers
+
         /**
          * @brief Address range of device identificator register
          * @see registers_device_identificator
@@ -114,6 +159,8 @@ namespace wl
         static constexpr AddressRange STATUS = AddressRange::firstAndSize(0x000C, 4);
 
         // General - 0x01xx
+        static constexpr AddressRange GENERAL_REGISTERS = AddressRange::firstToLast(0x0100, 0x01FF); ///< Address range of general registers
+
         /**
          * @brief Address range of firmware version
          * @see registers_main_firmware_version
@@ -181,6 +228,8 @@ namespace wl
         static constexpr AddressRange AUX_PIN_2 = AddressRange::firstAndSize(0x0180, 4);
 
         // Video - 0x02xx
+        static constexpr AddressRange VIDEO_REGISTERS = AddressRange::firstToLast(0x0200, 0x02FF); ///< Address range of video registers
+
         /**
          * @brief Address range of palette index register
          * @see registers_palette_index
@@ -236,6 +285,8 @@ namespace wl
         static constexpr AddressRange RETICLE_POSITION_Y = AddressRange::firstAndSize(0x023C, 4);
 
         // NUC - 0x03xx
+        static constexpr AddressRange NUC_REGISTERS = AddressRange::firstToLast(0x0300, 0x03FF); ///< Address range of NUC registers
+
 
         /**
          * @brief Address range of shutter counter register
@@ -274,6 +325,8 @@ namespace wl
         static constexpr AddressRange NUC_ADAPTIVE_THRESHOLD_CURRENT = AddressRange::firstAndSize(0x0324, 4);
 
         // Connection - 0x04xx
+        static constexpr AddressRange CONNECTION_REGISTERS = AddressRange::firstToLast(0x0400, 0x04FF); ///< Address range of connection registers
+
             /**
          * @brief Address range of UART baudrate register
          * @see registers_uart_baudrate
@@ -281,6 +334,8 @@ namespace wl
         static constexpr AddressRange UART_BAUDRATE_CURRENT = AddressRange::firstAndSize(0x0400, 4);
 
         // Filters - 0x06xx
+        static constexpr AddressRange FILTERS_REGISTERS = AddressRange::firstToLast(0x0600, 0x06FF); ///< Address range of filters registers
+
         /**
          * @brief Address range of time domain average register
          * @see registers_time_domain_average
@@ -366,6 +421,8 @@ namespace wl
         static constexpr AddressRange DAMPING_FACTOR = AddressRange::firstAndSize(0x063C, 4);
 
         // Presets - 0x0Axx
+        static constexpr AddressRange PRESETS_REGISTERS = AddressRange::firstToLast(0x0A00, 0x0AFF); ///< Address range of presets registers
+
         /**
          * @brief Address range of selected preset index register
          * @see registers_selected_preset_index
@@ -0,0 +1,131 @@
+#include "wl/weom/registercacheweom.h"
+
+#include <etl/algorithm.h>
+
+#include <cassert>
+
+
+namespace wl {
+
+void RegisterCacheWEOM::setPolicy(RegisterClassWEOM registerClass, RegisterCachePolicyWEOM policy)
+{
+    assert(registerClass != RegisterClassWEOM::CONTROL || policy == RegisterCachePolicyWEOM::DISABLED);
+    if (registerClass == RegisterClassWEOM::CONTROL)
+    {
+        return;
+    }
+
+    m_policies.at(static_cast<size_t>(registerClass)) = policy;
+    if (policy == RegisterCachePolicyWEOM::DISABLED)
+    {
+        m_entries.erase(etl::remove_if(m_entries.begin(), m_entries.end(), [registerClass](const Entry& entry)
+        {
+            return MemorySpaceWEOM::getRegisterClass(entry.addressRange) == registerClass;
+        }), m_entries.end());
+    }
+}
+
+RegisterCachePolicyWEOM RegisterCacheWEOM::getPolicy(RegisterClassWEOM registerClass) const
+{
+    return m_policies.at(static_cast<size_t>(registerClass));
+}
+
+bool RegisterCacheWEOM::isCacheable(const AddressRange& addressRange) const
+{
+    return addressRange.getSize() <= MAXIMUM_ENTRY_SIZE &&
+           MemorySpaceWEOM::CONFIGURATION_REGISTERS.contains(addressRange) &&
+           getPolicy(MemorySpaceWEOM::getRegisterClass(addressRange)) == RegisterCachePolicyWEOM::ENABLED;
+}
+
+bool RegisterCacheWEOM::read(const AddressRange& addressRange, etl::span<uint8_t> data) const
+{
+    assert(data.size() == addressRange.getSize());
+
+    const auto entry = etl::find_if(m_entries.begin(), m_entries.end(), [&addressRange](const Entry& entry)
+    {
+        return entry.addressRange == addressRange;
+    });
+    if (entry == m_entries.end())
+    {
+        return false;
+    }
+
+    etl::copy(entry->data.begin(), entry->data.begin() + addressRange.getSize(), data.begin());
+    return true;
+}
+
+void RegisterCacheWEOM::store(const AddressRange& addressRange, etl::span<const uint8_t> data)
+{
+    assert(data.size() == addressRange.getSize());
+
+    invalidate(addressRange);
+    if (!isCacheable(addressRange))
+    {
+        return;
+    }
+
+    if (m_entries.full())
+    {
+        // oldest entry first
+        m_entries.erase(m_entries.begin());
+    }
+
+    Entry entry {addressRange, {}};
+    etl::copy(data.begin(), data.end(), entry.data.begin());
+    m_entries.push_back(entry);
+}
+
+void RegisterCacheWEOM::invalidate(const AddressRange& addressRange)
+{
+    m_entries.erase(etl::remove_if(m_entries.begin(), m_entries.end(), [&addressRange](const Entry& entry)
+    {
+        return entry.addressRange.overlaps(addressRange);
+    }), m_entries.end());
+}
+
+void RegisterCacheWEOM::invalidate(const Status& status)
+{
+    if (status.presetsRegistersChanged() || status.bolometerRegistersChanged() || status.focusRegistersChanged())
+    {
+        invalidateAllExceptIdentification();
+    }
+    else if (status.nucRegistersChanged())
+    {
+        invalidate(MemorySpaceWEOM::NUC_REGISTERS);
+    }
+}
+
+void RegisterCacheWEOM::invalidate(Trigger trigger)
+{
+    switch (trigger)
+    {
+    case Trigger::RESET_FPGA:
+    case Trigger::RESET_TO_LOADER:
+    case Trigger::RESET_TO_FACTORY_DEFAULT:
+        clear();
+        break;
+    case Trigger::SET_SELECTED_PRESET:
+        invalidateAllExceptIdentification();
+        break;
+    case Trigger::NUC_OFFSET_UPDATE:
+        invalidate(MemorySpaceWEOM::NUC_REGISTERS);
+        break;
+    default:
+        break;
+    }
+}
+
+void RegisterCacheWEOM::clear()
+{
+    m_entries.clear();
+}
+
+void RegisterCacheWEOM::invalidateAllExceptIdentification()
+{
+    m_entries.erase(etl::remove_if(m_entries.begin(), m_entries.end(), [](const Entry& entry)
+    {
+        return MemorySpaceWEOM::getRegisterClass(entry.addressRange) != RegisterClassWEOM::IDENTIFICATION;
+    }), m_entries.end());
+}
+
+} // namespace wl
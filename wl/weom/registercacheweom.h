@@ -0,0 +1,125 @@
+#ifndef WL_REGISTERCACHEWEOM_H
+#define WL_REGISTERCACHEWEOM_H
+
+#include "wl/communication/addressrange.h"
+#include "wl/dataclasses/status.h"
+#include "wl/dataclasses/triggers.h"
+#include "wl/weom/memoryspaceweom.h"
+
+#include <etl/array.h>
+#include <etl/span.h>
+#include <etl/vector.h>
+
+#include <cstdint>
+
+namespace wl {
+
+/**
+ * @brief Enumeration of caching policies of a register class.
+ */
+enum class RegisterCachePolicyWEOM
+{
+    DISABLED, ///< Every read goes to the device
+    ENABLED,  ///< Reads are served from the cache until the value is invalidated
+};
+
+/**
+ * @class RegisterCacheWEOM
+ * @headerfile registercacheweom.h "wl/weom/registercacheweom.h"
+ * @brief Shadow copy of configuration registers, keyed by address range.
+ *
+ * @details
+ * Values are stored after successful reads and writes of registers whose class (see MemorySpaceWEOM::getRegisterClass)
+ * has caching enabled. The device can change registers on its own - entries are invalidated according to the flags
+ * of the status register and the triggers activated. Control registers are never cached.
+ * Caching is disabled for all classes by default.
+ */
+class RegisterCacheWEOM
+{
+public:
+    static constexpr size_t CAPACITY = 64;            ///< Maximum number of cached address ranges.
+    static constexpr uint32_t MAXIMUM_ENTRY_SIZE = 32; ///< Largest cached address range in bytes.
+
+    /**
+     * @brief Sets the caching policy of a register class.
+     * @param registerClass The register class, RegisterClassWEOM::CONTROL cannot be cached.
+     * @param policy The caching policy.
+     */
+    void setPolicy(RegisterClassWEOM registerClass, RegisterCachePolicyWEOM policy);
+
+    /**
+     * @brief Retrieves the caching policy of a register class.
+     * @param registerClass The register class.
+     * @return The caching policy.
+     */
+    RegisterCachePolicyWEOM getPolicy(RegisterClassWEOM registerClass) const;
+
+    /**
+     * @brief Checks if the address range may be cached.
+     * @param addressRange The address range.
+     * @return True if the policy of the register class allows caching and the range fits into an entry, false otherwise.
+     */
+    bool isCacheable(const AddressRange& addressRange) const;
+
+    /**
+     * @brief Retrieves cached content of the address range.
+     * @param addressRange The address range, it has to match the range of a stored value exactly.
+     * @param data Buffer of the address range size to fill.
+     * @return True if the value was cached, false otherwise (data are left untouched).
+     */
+    bool read(const AddressRange& addressRange, etl::span<uint8_t> data) const;
+
+    /**
+     * @brief Stores content of the address range read from or written to the device.
+     *
+     * Entries overlapping the address range are invalidated even if the range itself is not cacheable.
+     * @param addressRange The address range.
+     * @param data Content of the address range.
+     */
+    void store(const AddressRange& addressRange, etl::span<const uint8_t> data);
+
+    /**
+     * @brief Invalidates all entries overlapping the address range.
+     * @param addressRange The address range.
+     */
+    void invalidate(const AddressRange& addressRange);
+
+    /**
+     * @brief Invalidates entries of register groups the status reports as changed by the device.
+     *
+     * NUC registers are invalidated on Status::nucRegistersChanged(). Presets, bolometer and focus changes
+     * may affect any setting, so all entries except identification are invalidated.
+     * @param status The status read from the device.
+     */
+    void invalidate(const Status& status);
+
+    /**
+     * @brief Invalidates entries the activated trigger may change.
+     *
+     * Resets invalidate everything, preset selection all entries except identification, NUC offset update the NUC registers.
+     * @param trigger The trigger activated.
+     */
+    void invalidate(Trigger trigger);
+
+    /**
+     * @brief Invalidates all entries.
+     */
+    void clear();
+
+private:
+    struct Entry
+    {
+        AddressRange addressRange;
+        etl::array<uint8_t, MAXIMUM_ENTRY_SIZE> data;
+    };
+
+    void invalidateAllExceptIdentification();
+
+    etl::vector<Entry, CAPACITY> m_entries;
+    etl::array<RegisterCachePolicyWEOM, 4> m_policies {RegisterCachePolicyWEOM::DISABLED, RegisterCachePolicyWEOM::DISABLED,
+                                                       RegisterCachePolicyWEOM::DISABLED, RegisterCachePolicyWEOM::DISABLED};
+};
+
+} // namespace wl
+
+#endif // WL_REGISTERCACHEWEOM_H